@@ -2,15 +2,19 @@
 
 #pragma once
 
-#include "object/object.hpp" // for Object
+#include "container/arena.hpp" // for Arena
+#include "object/object.hpp"   // for Object
 
 #include <metal/lambda/apply.hpp>  // for apply
 #include <metal/list/contains.hpp> // for contains
 #include <metal/list/list.hpp>     // for list
 
 #include <algorithm> // for reverse
+#include <atomic>    // for atomic
+#include <cstdint>   // for uint8_t, uint16_t, uint32_t
 #include <iosfwd>
 #include <iterator>    // for back_inserter
+#include <limits>      // for numeric_limits
 #include <memory>      // for make_shared, shared_ptr
 #include <optional>    // for optional
 #include <string>      // for basic_string
@@ -39,15 +43,14 @@ namespace chimera::library::asdl {
     struct Impl {
       using List = metal::list<Types...>;
       using ValueT = metal::apply<metal::lambda<std::variant>, List>;
-      Impl() : value(std::make_shared<ValueT>()) {}
+      Impl() : value(make()) {}
       template <typename Type,
                 typename = std::enable_if_t<metal::contains<List, Type>() != 0>>
-      Impl(Type &&type)
-          : value(std::make_shared<ValueT>(std::forward<Type>(type))) {}
+      Impl(Type &&type) : value(make(std::forward<Type>(type))) {}
       template <typename Type,
                 typename = std::enable_if_t<metal::contains<List, Type>() != 0>>
       auto operator=(Type &&type) -> Impl & {
-        value = std::make_shared<ValueT>(ValueT{std::forward<Type>(type)});
+        value = make(std::forward<Type>(type));
         return *this;
       }
       template <typename Type,
@@ -75,6 +78,17 @@ namespace chimera::library::asdl {
       }
 
     private:
+      //! nodes made while parsing live in the tree's arena, copies share
+      //! them without counting references
+      template <typename... Args>
+      [[nodiscard]] static auto make(Args &&...args)
+          -> std::shared_ptr<ValueT> {
+        if (auto *arena = container::Arena::current(); arena != nullptr) {
+          return {std::shared_ptr<void>(),
+                  arena->make<ValueT>(std::forward<Args>(args)...)};
+        }
+        return std::make_shared<ValueT>(std::forward<Args>(args)...);
+      }
       std::shared_ptr<ValueT> value;
     };
   } // namespace detail
@@ -86,8 +100,29 @@ namespace chimera::library::asdl {
       struct NameConstant, object::Object, struct Set, struct SetComp,
       struct Starred, struct Subscript, struct Tuple, struct Unary,
       struct UnpackDict, struct Yield, struct YieldFrom>;
+  //! where the evaluator finds a variable, set once by resolve
+  struct Binding {
+    enum Kind : std::uint8_t {
+      //! an attribute of the scope object, class bodies and anything not
+      //! resolved yet
+      UNRESOLVED,
+      //! a slot in the frame of the innermost function
+      LOCAL,
+      //! an attribute of the module, then of the builtins when reading
+      GLOBAL,
+      //! bound by an enclosing function
+      FREE,
+    };
+    Kind kind = UNRESOLVED;
+    std::uint32_t slot = 0;
+  };
   struct Name {
     std::string value;
+    //! last shape this name was looked up in by the evaluator
+    mutable object::InlineCache cache{};
+    //! last shape of the builtins a global read fell back to
+    mutable object::InlineCache builtin{};
+    mutable Binding binding{};
   };
   struct ModuleName {
     std::string value;
@@ -159,9 +194,102 @@ namespace chimera::library::asdl {
     Op op = AND;
     std::vector<ExprImpl> values{};
   };
+  //! operand types one node kept seeing, the evaluator switches the node to
+  //! a specialised step once they have been stable for long enough and back
+  //! on the first miss
+  class Quickening {
+  public:
+    enum Kind : std::uint8_t { GENERIC, INT };
+    //! executions in a row with the same operand kind before specialising
+    static constexpr std::uint8_t threshold = 8;
+    Quickening() noexcept = default;
+    Quickening(const Quickening &other) noexcept
+        : state(other.state.load(std::memory_order_relaxed)) {}
+    Quickening(Quickening &&other) noexcept
+        : state(other.state.load(std::memory_order_relaxed)) {}
+    ~Quickening() noexcept = default;
+    auto operator=(const Quickening &other) noexcept -> Quickening & {
+      state.store(other.state.load(std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+      return *this;
+    }
+    auto operator=(Quickening &&other) noexcept -> Quickening & {
+      state.store(other.state.load(std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+      return *this;
+    }
+    //! the specialised kind, GENERIC until a streak reached the threshold
+    [[nodiscard]] auto kind() const noexcept -> Kind {
+      return static_cast<Kind>(state.load(std::memory_order_relaxed) &
+                               kindMask);
+    }
+    //! true when this observation specialised the node
+    auto observe(Kind kind) noexcept -> bool {
+      auto current = state.load(std::memory_order_relaxed);
+      auto streak = static_cast<std::uint16_t>(current >> kindBits);
+      if (kind == GENERIC || streak + 1U < threshold) {
+        streak = kind == GENERIC ? 0 : streak + 1;
+        state.store(static_cast<std::uint16_t>(streak << kindBits),
+                    std::memory_order_relaxed);
+        return false;
+      }
+      state.store(kind, std::memory_order_relaxed);
+      return true;
+    }
+    void deoptimize() noexcept { state.store(0, std::memory_order_relaxed); }
+
+  private:
+    static constexpr std::uint16_t kindBits = 8;
+    static constexpr std::uint16_t kindMask = (1U << kindBits) - 1;
+    //! streak in the high byte, specialised kind in the low byte
+    std::atomic<std::uint16_t> state{0};
+  };
+  //! expansions of one loop body, the evaluator records the steps of a hot
+  //! body once and replays them, kept on the node so every evaluator that
+  //! runs the loop shares the count
+  class Hotness {
+  public:
+    //! expansions before a body is recorded
+    static constexpr std::uint16_t threshold = 4;
+    Hotness() noexcept = default;
+    Hotness(const Hotness &other) noexcept
+        : runs(other.runs.load(std::memory_order_relaxed)) {}
+    Hotness(Hotness &&other) noexcept
+        : runs(other.runs.load(std::memory_order_relaxed)) {}
+    ~Hotness() noexcept = default;
+    auto operator=(const Hotness &other) noexcept -> Hotness & {
+      runs.store(other.runs.load(std::memory_order_relaxed),
+                 std::memory_order_relaxed);
+      return *this;
+    }
+    auto operator=(Hotness &&other) noexcept -> Hotness & {
+      runs.store(other.runs.load(std::memory_order_relaxed),
+                 std::memory_order_relaxed);
+      return *this;
+    }
+    //! counts one expansion, true once the body reached the threshold
+    auto run() noexcept -> bool {
+      auto current = runs.load(std::memory_order_relaxed);
+      if (current == never) {
+        return false;
+      }
+      if (current < threshold) {
+        runs.store(++current, std::memory_order_relaxed);
+      }
+      return current >= threshold;
+    }
+    //! for a body that does work while expanding, it is always expanded
+    void disable() noexcept { runs.store(never, std::memory_order_relaxed); }
+
+  private:
+    static constexpr std::uint16_t never =
+        std::numeric_limits<std::uint16_t>::max();
+    std::atomic<std::uint16_t> runs{0};
+  };
   struct Bin {
     Operator op{};
     std::vector<ExprImpl> values{};
+    mutable Quickening quickening{};
   };
   struct Unary {
     enum Op {
@@ -176,6 +304,8 @@ namespace chimera::library::asdl {
   struct Lambda {
     Arguments args;
     ExprImpl body;
+    //! frame slots for arguments and locals, set by resolve
+    mutable std::uint32_t locals = 0;
   };
   struct IfExp {
     ExprImpl test;
@@ -345,6 +475,7 @@ namespace chimera::library::asdl {
     ExprImpl test;
     std::vector<StmtImpl> body{};
     std::vector<StmtImpl> orelse{};
+    mutable Hotness hotness{};
   };
   struct AsyncFor {
     ExprImpl target;
@@ -357,6 +488,7 @@ namespace chimera::library::asdl {
     ExprImpl iter;
     std::vector<StmtImpl> body{};
     std::vector<StmtImpl> orelse{};
+    mutable Hotness hotness{};
   };
   struct AugAssign {
     ExprImpl target;
@@ -394,6 +526,8 @@ namespace chimera::library::asdl {
     std::vector<StmtImpl> body{};
     std::vector<ExprImpl> decorator_list{};
     std::optional<ExprImpl> returns{};
+    //! frame slots for arguments and locals, set by resolve
+    mutable std::uint32_t locals = 0;
   };
   struct FunctionDef {
     Name name;
@@ -402,19 +536,51 @@ namespace chimera::library::asdl {
     std::vector<StmtImpl> body{};
     std::vector<ExprImpl> decorator_list{};
     std::optional<ExprImpl> returns{};
+    //! frame slots for arguments and locals, set by resolve
+    mutable std::uint32_t locals = 0;
   };
+  //! binds every variable in a module level body or expression to a frame
+  //! slot, the module or an enclosing function
+  void resolve(const std::vector<StmtImpl> &body);
+  void resolve(const ExprImpl &expr);
   struct BaseASDL {
     struct NullTransaction {
       static void commit() noexcept {}
     };
+    BaseASDL() : arena(std::make_shared<container::Arena>()) {}
+    explicit BaseASDL(std::shared_ptr<container::Arena> arena) noexcept
+        : arena(std::move(arena)) {}
     [[nodiscard]] static auto transaction() noexcept -> NullTransaction {
       return {};
     }
+
+  protected:
+    //! nodes created on this thread while the result lives belong to this
+    //! tree, they are all freed with its last copy
+    [[nodiscard]] auto use_arena() const noexcept -> container::Arena::Use {
+      return container::Arena::Use(*arena);
+    }
+    //! lives as long as the tree, for buffers its nodes may point into
+    template <typename Type, typename... Args>
+    [[nodiscard]] auto keep(Args &&...args) -> const Type & {
+      return *arena->make<Type>(std::forward<Args>(args)...);
+    }
+
+  private:
+    std::shared_ptr<container::Arena> arena;
   };
   struct Module : BaseASDL {
     Module() = default;
     Module(const options::Optimize &optimize, std::istream &input,
            const char *source);
+    //! parses a regular file in place from a read only mapping
+    Module(const options::Optimize &optimize, const char *path);
+    Module(std::shared_ptr<container::Arena> arena, std::vector<StmtImpl> body,
+           std::optional<DocString> doc_string)
+        : BaseASDL(std::move(arena)), body(std::move(body)),
+          doc_string(std::move(doc_string)) {
+      resolve(this->body);
+    }
     [[nodiscard]] auto doc() const -> const std::optional<DocString> &;
     [[nodiscard]] auto iter() const -> const std::vector<StmtImpl> &;
     template <typename Stack>
@@ -14,8 +14,10 @@ namespace chimera::library::options {
 namespace chimera::library::asdl {
   Expression::Expression(const options::Optimize &optimize, std::istream &input,
                          const char *source) {
+    const auto nodes = use_arena();
     grammar::parse<grammar::EvalInput>(optimize, grammar::Input(input, source),
                                        *this);
+    resolve(body);
   }
   [[nodiscard]] auto Expression::expr() const -> const ExprImpl & {
     return body;
@@ -15,8 +15,10 @@ namespace chimera::library::options {
 namespace chimera::library::asdl {
   Interactive::Interactive(const options::Optimize &optimize,
                            std::istream &input, const char *source) {
+    const auto nodes = use_arena();
     grammar::parse<grammar::SingleInput>(optimize,
                                          grammar::Input(input, source), *this);
+    resolve(body);
   }
   [[nodiscard]] auto Interactive::iter() const
       -> const std::vector<StmtImpl> & {
@@ -0,0 +1,31 @@
+//! wrapper for tao::pegtl::parse
+
+#include "asdl/asdl.hpp"             // for Module
+#include "container/mapped_file.hpp" // for MappedFile
+#include "grammar/grammar.hpp"       // for FileInput
+#include "grammar/input.hpp"         // for Input, MemoryInput
+#include "grammar/parse.hpp"         // for parse
+
+#include <fstream> // for ifstream
+
+namespace chimera::library::options {
+  enum class Optimize;
+} // namespace chimera::library::options
+
+namespace chimera::library::asdl {
+  Module::Module(const options::Optimize &optimize, const char *path) {
+    const auto nodes = use_arena();
+    const auto &mapped = keep<container::MappedFile>(path);
+    if (auto view = mapped.view(); !view.empty()) {
+      grammar::parse<grammar::FileInput>(
+          optimize, grammar::MemoryInput(view, path), *this);
+      resolve(body);
+      return;
+    }
+    // empty files and anything that cannot be mapped are read as a stream
+    std::ifstream input(path, std::ios::in | std::ios::binary);
+    grammar::parse<grammar::FileInput>(optimize, grammar::Input(input, path),
+                                       *this);
+    resolve(body);
+  }
+} // namespace chimera::library::asdl
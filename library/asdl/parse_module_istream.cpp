@@ -15,8 +15,10 @@ namespace chimera::library::options {
 namespace chimera::library::asdl {
   Module::Module(const options::Optimize &optimize, std::istream &input,
                  const char *source) {
+    const auto nodes = use_arena();
     grammar::parse<grammar::FileInput>(optimize, grammar::Input(input, source),
                                        *this);
+    resolve(body);
   }
   [[nodiscard]] auto Module::doc() const -> const std::optional<DocString> & {
     return doc_string;
@@ -0,0 +1,444 @@
+//! binds every variable to the scope that owns it before evaluation
+
+#include "asdl/asdl.hpp"
+
+#include <cstdint> // for uint32_t, uint8_t
+#include <map>     // for map
+#include <string>  // for string
+#include <variant> // for variant, visit
+#include <vector>  // for vector
+
+namespace chimera::library::asdl {
+  //! names declared, bound and used directly in one module, class or
+  //! function body
+  struct SymbolScope {
+    enum Type : std::uint8_t { MODULE, CLASS, FUNCTION };
+    using Nested =
+        std::variant<const FunctionDef *, const AsyncFunctionDef *,
+                     const ClassDef *, const Lambda *, const ListComp *,
+                     const SetComp *, const DictComp *, const GeneratorExp *>;
+    const SymbolScope *parent = nullptr;
+    Type type = MODULE;
+    std::map<std::string, Binding::Kind> declared{};
+    //! bound names in order of first binding, arguments come first
+    std::vector<std::string> bound{};
+    std::map<std::string, std::uint32_t> slots{};
+    std::vector<const Name *> names{};
+    //! bodies resolved once every name of this scope is known
+    std::vector<Nested> nested{};
+  };
+  //! walks one scope, nested scopes are only recorded
+  class SymbolTable {
+  public:
+    explicit SymbolTable(SymbolScope &scope) noexcept : scope(&scope) {}
+    void body(const std::vector<StmtImpl> &body) {
+      for (const auto &stmt : body) {
+        stmt.visit(*this);
+      }
+    }
+    void load(const ExprImpl &expr) { expr.visit(*this); }
+    void load(const std::optional<ExprImpl> &expr) {
+      if (expr) {
+        load(*expr);
+      }
+    }
+    void load(const std::vector<ExprImpl> &exprs) {
+      for (const auto &expr : exprs) {
+        load(expr);
+      }
+    }
+    void store(const ExprImpl &expr) {
+      expr.visit([this](const auto &target) { this->target(target); });
+    }
+    void bind(const Name &name) {
+      if (scope->slots.try_emplace(name.value).second) {
+        scope->bound.push_back(name.value);
+      }
+      scope->names.push_back(&name);
+    }
+    //! defaults and annotations belong to the scope defining the function
+    void arguments(const Arguments &args) {
+      auto each = [this](const Arg &arg) {
+        load(arg.annotation);
+        load(arg.arg_default);
+      };
+      for (const auto &arg : args.args) {
+        each(arg);
+      }
+      if (args.vararg) {
+        each(*args.vararg);
+      }
+      for (const auto &arg : args.kwonlyargs) {
+        each(arg);
+      }
+      if (args.kwarg) {
+        each(*args.kwarg);
+      }
+    }
+    void parameters(const Arguments &args) {
+      for (const auto &arg : args.args) {
+        bind(arg.name);
+      }
+      if (args.vararg) {
+        bind(args.vararg->name);
+      }
+      for (const auto &arg : args.kwonlyargs) {
+        bind(arg.name);
+      }
+      if (args.kwarg) {
+        bind(args.kwarg->name);
+      }
+    }
+    //! the first iterable is evaluated where the comprehension appears
+    template <typename Comprehension>
+    void comprehension(const Comprehension &comprehension) {
+      load(comprehension.generators.front().iter);
+      scope->nested.emplace_back(&comprehension);
+    }
+    void generators(const std::vector<Comprehension> &generators) {
+      for (auto begin = generators.begin(); begin != generators.end();
+           ++begin) {
+        if (begin != generators.begin()) {
+          load(begin->iter);
+        }
+        store(begin->target);
+        load(begin->ifs);
+      }
+    }
+    // statements
+    void operator()(const AnnAssign &annAssign) {
+      store(annAssign.target);
+      load(annAssign.annotation);
+      load(annAssign.value);
+    }
+    void operator()(const Assert &assert) {
+      load(assert.test);
+      load(assert.msg);
+    }
+    void operator()(const Assign &assign) {
+      for (const auto &target : assign.targets) {
+        store(target);
+      }
+      load(assign.value);
+    }
+    void operator()(const AsyncFor &asyncFor) {
+      store(asyncFor.target);
+      load(asyncFor.iter);
+      body(asyncFor.body);
+      body(asyncFor.orelse);
+    }
+    void operator()(const AsyncFunctionDef &asyncFunctionDef) {
+      load(asyncFunctionDef.decorator_list);
+      arguments(asyncFunctionDef.args);
+      load(asyncFunctionDef.returns);
+      bind(asyncFunctionDef.name);
+      scope->nested.emplace_back(&asyncFunctionDef);
+    }
+    void operator()(const AsyncWith &asyncWith) {
+      for (const auto &item : asyncWith.items) {
+        load(item.context_expr);
+        if (item.optional_vars) {
+          store(*item.optional_vars);
+        }
+      }
+      body(asyncWith.body);
+    }
+    void operator()(const AugAssign &augAssign) {
+      store(augAssign.target);
+      load(augAssign.value);
+    }
+    void operator()(const Break & /*asdlBreak*/) {}
+    void operator()(const ClassDef &classDef) {
+      load(classDef.decorator_list);
+      load(classDef.bases);
+      for (const auto &keyword : classDef.keywords) {
+        load(keyword.value);
+      }
+      bind(classDef.name);
+      scope->nested.emplace_back(&classDef);
+    }
+    void operator()(const Continue & /*asdlContinue*/) {}
+    void operator()(const Delete &asdlDelete) {
+      for (const auto &target : asdlDelete.targets) {
+        store(target);
+      }
+    }
+    void operator()(const Expr &expr) { load(expr.value); }
+    void operator()(const For &asdlFor) {
+      store(asdlFor.target);
+      load(asdlFor.iter);
+      body(asdlFor.body);
+      body(asdlFor.orelse);
+    }
+    void operator()(const FunctionDef &functionDef) {
+      load(functionDef.decorator_list);
+      arguments(functionDef.args);
+      load(functionDef.returns);
+      bind(functionDef.name);
+      scope->nested.emplace_back(&functionDef);
+    }
+    void operator()(const Global &global) {
+      for (const auto &name : global.names) {
+        scope->declared.insert_or_assign(name.value, Binding::GLOBAL);
+        scope->names.push_back(&name);
+      }
+    }
+    void operator()(const If &asdlIf) {
+      for (const auto &branch : asdlIf.body) {
+        load(branch.test);
+        body(branch.body);
+      }
+      body(asdlIf.orelse);
+    }
+    void operator()(const Import &import) {
+      for (const auto &alias : import.names) {
+        bind(alias.asname ? *alias.asname : alias.name);
+      }
+    }
+    void operator()(const ImportFrom &importFrom) {
+      for (const auto &alias : importFrom.names) {
+        bind(alias.asname ? *alias.asname : alias.name);
+      }
+    }
+    void operator()(const Nonlocal &nonlocal) {
+      for (const auto &name : nonlocal.names) {
+        scope->declared.insert_or_assign(name.value, Binding::FREE);
+        scope->names.push_back(&name);
+      }
+    }
+    void operator()(const Raise &raise) {
+      load(raise.exc);
+      load(raise.cause);
+    }
+    void operator()(const Return &asdlReturn) { load(asdlReturn.value); }
+    void operator()(const Try &asdlTry) {
+      body(asdlTry.body);
+      for (const auto &handler : asdlTry.handlers) {
+        std::visit(
+            [this](const ExceptHandler &exceptHandler) {
+              load(exceptHandler.type);
+              if (exceptHandler.name) {
+                bind(*exceptHandler.name);
+              }
+              body(exceptHandler.body);
+            },
+            handler);
+      }
+      body(asdlTry.orelse);
+      body(asdlTry.finalbody);
+    }
+    void operator()(const While &asdlWhile) {
+      load(asdlWhile.test);
+      body(asdlWhile.body);
+      body(asdlWhile.orelse);
+    }
+    void operator()(const With &with) {
+      for (const auto &item : with.items) {
+        load(item.context_expr);
+        if (item.optional_vars) {
+          store(*item.optional_vars);
+        }
+      }
+      body(with.body);
+    }
+    // expressions
+    void operator()(const Attribute &attribute) { load(attribute.value); }
+    void operator()(const Await &await) { load(await.value); }
+    void operator()(const Bin &bin) { load(bin.values); }
+    void operator()(const Bool &asdlBool) { load(asdlBool.values); }
+    void operator()(const Call &call) {
+      load(call.func);
+      load(call.args);
+      for (const auto &keyword : call.keywords) {
+        load(keyword.value);
+      }
+    }
+    void operator()(const Compare &compare) {
+      load(compare.left);
+      for (const auto &comparator : compare.comparators) {
+        load(comparator.value);
+      }
+    }
+    void operator()(const Dict &dict) {
+      load(dict.keys);
+      load(dict.values);
+    }
+    void operator()(const DictComp &dictComp) { comprehension(dictComp); }
+    void operator()(const Ellipsis & /*ellipsis*/) {}
+    void operator()(const FormattedValue &formattedValue) {
+      load(formattedValue.value);
+      load(formattedValue.format_spec);
+    }
+    void operator()(const GeneratorExp &generatorExp) {
+      comprehension(generatorExp);
+    }
+    void operator()(const IfExp &ifExp) {
+      load(ifExp.test);
+      load(ifExp.body);
+      load(ifExp.orelse);
+    }
+    void operator()(const JoinedStr &joinedStr) { load(joinedStr.values); }
+    void operator()(const Lambda &lambda) {
+      arguments(lambda.args);
+      scope->nested.emplace_back(&lambda);
+    }
+    void operator()(const List &list) { load(list.elts); }
+    void operator()(const ListComp &listComp) { comprehension(listComp); }
+    void operator()(const Name &name) { scope->names.push_back(&name); }
+    void operator()(const NameConstant & /*nameConstant*/) {}
+    void operator()(const object::Object & /*object*/) {}
+    void operator()(const Set &set) { load(set.elts); }
+    void operator()(const SetComp &setComp) { comprehension(setComp); }
+    void operator()(const Starred &starred) { load(starred.value); }
+    void operator()(const Subscript &subscript) {
+      load(subscript.value);
+      subscript.slice.visit(*this);
+    }
+    void operator()(const Tuple &tuple) { load(tuple.elts); }
+    void operator()(const Unary &unary) { load(unary.operand); }
+    void operator()(const UnpackDict & /*unpackDict*/) {}
+    void operator()(const Yield &yield) { load(yield.value); }
+    void operator()(const YieldFrom &yieldFrom) { load(yieldFrom.value); }
+    // slices
+    void operator()(const ExtSlice &extSlice) {
+      for (const auto &dim : extSlice.dims) {
+        dim.visit(*this);
+      }
+    }
+    void operator()(const Index &index) { load(index.value); }
+    void operator()(const Slice &slice) {
+      load(slice.lower);
+      load(slice.upper);
+      load(slice.step);
+    }
+
+  private:
+    //! names, tuples, lists and starred names bind, anything else is read
+    void target(const Name &name) { bind(name); }
+    void target(const List &list) {
+      for (const auto &elt : list.elts) {
+        store(elt);
+      }
+    }
+    void target(const Starred &starred) { store(starred.value); }
+    void target(const Tuple &tuple) {
+      for (const auto &elt : tuple.elts) {
+        store(elt);
+      }
+    }
+    template <typename Type>
+    void target(const Type &expr) {
+      (*this)(expr);
+    }
+    SymbolScope *scope;
+  };
+  //! where a name used directly in scope is found
+  static auto lookup(const SymbolScope &scope, const std::string &name)
+      -> Binding {
+    if (auto found = scope.declared.find(name); found != scope.declared.end()) {
+      return {.kind = found->second};
+    }
+    switch (scope.type) {
+      case SymbolScope::MODULE:
+        return {.kind = Binding::GLOBAL};
+      case SymbolScope::CLASS:
+        return {};
+      case SymbolScope::FUNCTION:
+        break;
+    }
+    if (auto found = scope.slots.find(name); found != scope.slots.end()) {
+      return {.kind = Binding::LOCAL, .slot = found->second};
+    }
+    for (const auto *outer = scope.parent;
+         outer != nullptr && outer->type != SymbolScope::MODULE;
+         outer = outer->parent) {
+      if (outer->type == SymbolScope::CLASS) {
+        continue;
+      }
+      if (auto found = outer->declared.find(name);
+          found != outer->declared.end()) {
+        return {.kind = found->second};
+      }
+      if (outer->slots.contains(name)) {
+        return {.kind = Binding::FREE};
+      }
+    }
+    return {.kind = Binding::GLOBAL};
+  }
+  static void finish(SymbolScope &scope);
+  static auto enter(const SymbolScope &parent, SymbolScope::Type type)
+      -> SymbolScope {
+    return {.parent = &parent, .type = type};
+  }
+  template <typename Function>
+  static void function(const SymbolScope &parent, const Function &function) {
+    auto scope = enter(parent, SymbolScope::FUNCTION);
+    SymbolTable table(scope);
+    table.parameters(function.args);
+    if constexpr (std::is_same_v<Function, Lambda>) {
+      table.load(function.body);
+    } else {
+      table.body(function.body);
+    }
+    finish(scope);
+    function.locals = static_cast<std::uint32_t>(scope.slots.size());
+  }
+  static void nested(const SymbolScope &parent, const ClassDef &classDef) {
+    auto scope = enter(parent, SymbolScope::CLASS);
+    SymbolTable(scope).body(classDef.body);
+    finish(scope);
+  }
+  template <typename Comprehension>
+  static void nested(const SymbolScope &parent,
+                     const Comprehension &comprehension) {
+    auto scope = enter(parent, SymbolScope::FUNCTION);
+    SymbolTable table(scope);
+    table.generators(comprehension.generators);
+    if constexpr (std::is_same_v<Comprehension, DictComp>) {
+      table.load(comprehension.key);
+      table.load(comprehension.value);
+    } else {
+      table.load(comprehension.elt);
+    }
+    finish(scope);
+  }
+  static void nested(const SymbolScope &parent,
+                     const FunctionDef &functionDef) {
+    function(parent, functionDef);
+  }
+  static void nested(const SymbolScope &parent,
+                     const AsyncFunctionDef &asyncFunctionDef) {
+    function(parent, asyncFunctionDef);
+  }
+  static void nested(const SymbolScope &parent, const Lambda &lambda) {
+    function(parent, lambda);
+  }
+  //! slots go to bound names that are not declared global or nonlocal
+  static void finish(SymbolScope &scope) {
+    scope.slots.clear();
+    if (scope.type == SymbolScope::FUNCTION) {
+      for (const auto &name : scope.bound) {
+        if (!scope.declared.contains(name)) {
+          scope.slots.emplace(
+              name, static_cast<std::uint32_t>(scope.slots.size()));
+        }
+      }
+    }
+    for (const auto *name : scope.names) {
+      name->binding = lookup(scope, name->value);
+    }
+    for (const auto &each : scope.nested) {
+      std::visit([&scope](const auto *node) { nested(scope, *node); }, each);
+    }
+  }
+  void resolve(const std::vector<StmtImpl> &body) {
+    SymbolScope scope;
+    SymbolTable(scope).body(body);
+    finish(scope);
+  }
+  void resolve(const ExprImpl &expr) {
+    SymbolScope scope;
+    SymbolTable(scope).load(expr);
+    finish(scope);
+  }
+} // namespace chimera::library::asdl
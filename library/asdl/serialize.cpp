@@ -0,0 +1,582 @@
+//! binary form of a parsed module for the compiled code cache
+
+#include "asdl/serialize.hpp"
+
+#include "asdl/asdl.hpp"
+#include "container/arena.hpp"
+#include "object/object.hpp"
+
+#include <charconv>     // for from_chars
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t, uint32_t, uint64_t
+#include <cstring>      // for memcpy
+#include <memory>       // for make_shared
+#include <optional>     // for optional
+#include <sstream>      // for ostringstream
+#include <stdexcept>    // for runtime_error
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <system_error> // for errc
+#include <type_traits>  // for conditional_t, is_enum_v, is_same_v
+#include <utility>      // for index_sequence, move
+#include <variant>      // for variant, variant_alternative_t
+#include <vector>       // for vector
+
+using namespace std::literals;
+
+namespace chimera::library::asdl {
+  //! the member type an archive visits, const while writing
+  template <typename Archive, typename Type>
+  using Field = std::conditional_t<Archive::writing, const Type, Type>;
+  template <typename Type, typename Variant>
+  struct Alternative;
+  template <typename Type, typename... Types>
+  struct Alternative<Type, std::variant<Types...>> {
+    static constexpr std::uint32_t value = [] {
+      std::uint32_t index = 0;
+      static_cast<void>(((std::is_same_v<Type, Types> || (++index, false)) ||
+                         ...));
+      return index;
+    }();
+  };
+  enum class Constant : std::uint8_t {
+    BYTES,
+    NUMBER,
+    STRING,
+  };
+  template <typename Archive, typename Empty>
+    requires std::is_empty_v<Empty>
+  void fields(Archive & /*archive*/, Empty & /*value*/) {}
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Name> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, ModuleName> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, DocString> &value) {
+    archive(value.string);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Withitem> &value) {
+    archive(value.context_expr, value.optional_vars);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Alias> &value) {
+    archive(value.name, value.asname);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Keyword> &value) {
+    archive(value.arg, value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Arg> &value) {
+    archive(value.name, value.annotation, value.arg_default);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Arguments> &value) {
+    archive(value.args, value.vararg, value.kwonlyargs, value.kwarg);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Comprehension> &value) {
+    archive(value.target, value.iter, value.ifs, value.is_async);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Slice> &value) {
+    archive(value.lower, value.upper, value.step);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Index> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, ExtSlice> &value) {
+    archive(value.dims);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Bool> &value) {
+    archive(value.op, value.values);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Bin> &value) {
+    archive(value.op, value.values);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Unary> &value) {
+    archive(value.op, value.operand);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Lambda> &value) {
+    archive(value.args, value.body);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, IfExp> &value) {
+    archive(value.test, value.body, value.orelse);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Dict> &value) {
+    archive(value.keys, value.values);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Set> &value) {
+    archive(value.elts);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, ListComp> &value) {
+    archive(value.elt, value.generators);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, SetComp> &value) {
+    archive(value.elt, value.generators);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, DictComp> &value) {
+    archive(value.key, value.value, value.generators);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, GeneratorExp> &value) {
+    archive(value.elt, value.generators);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Await> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Yield> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, YieldFrom> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, CompareExpr> &value) {
+    archive(value.op, value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Compare> &value) {
+    archive(value.left, value.comparators);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Call> &value) {
+    archive(value.func, value.args, value.keywords);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, FormattedValue> &value) {
+    archive(value.value, value.conversion, value.format_spec);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, JoinedStr> &value) {
+    archive(value.values);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, NameConstant> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Attribute> &value) {
+    archive(value.value, value.attr);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Subscript> &value) {
+    archive(value.value, value.slice);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Starred> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, List> &value) {
+    archive(value.elts);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Tuple> &value) {
+    archive(value.elts);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Expr> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Nonlocal> &value) {
+    archive(value.names);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Global> &value) {
+    archive(value.names);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, ImportFrom> &value) {
+    archive(value.module, value.names);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Import> &value) {
+    archive(value.names);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Assert> &value) {
+    archive(value.test, value.msg);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, ExceptHandler> &value) {
+    archive(value.type, value.name, value.body);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Try> &value) {
+    archive(value.body, value.handlers, value.orelse, value.finalbody);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Raise> &value) {
+    archive(value.exc, value.cause);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, AsyncWith> &value) {
+    archive(value.items, value.body);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, With> &value) {
+    archive(value.items, value.body);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, IfBranch> &value) {
+    archive(value.test, value.body);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, If> &value) {
+    archive(value.body, value.orelse);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, While> &value) {
+    archive(value.test, value.body, value.orelse);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, AsyncFor> &value) {
+    archive(value.target, value.iter, value.body, value.orelse);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, For> &value) {
+    archive(value.target, value.iter, value.body, value.orelse);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, AugAssign> &value) {
+    archive(value.target, value.op, value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, AnnAssign> &value) {
+    archive(value.target, value.annotation, value.value, value.simple);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Assign> &value) {
+    archive(value.targets, value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Delete> &value) {
+    archive(value.targets);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, Return> &value) {
+    archive(value.value);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, ClassDef> &value) {
+    archive(value.name, value.doc_string, value.bases, value.keywords,
+            value.body, value.decorator_list);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, AsyncFunctionDef> &value) {
+    archive(value.name, value.doc_string, value.args, value.body,
+            value.decorator_list, value.returns);
+  }
+  template <typename Archive>
+  void fields(Archive &archive, Field<Archive, FunctionDef> &value) {
+    archive(value.name, value.doc_string, value.args, value.body,
+            value.decorator_list, value.returns);
+  }
+  struct Writer {
+    static constexpr bool writing = true;
+    template <typename... Values>
+    void operator()(const Values &...values) {
+      (process(values), ...);
+    }
+    std::string output{};
+
+  private:
+    void raw(const void *data, std::size_t size) {
+      output.append(static_cast<const char *>(data), size);
+    }
+    template <typename Integral>
+      requires std::is_integral_v<Integral>
+    void process(Integral value) {
+      raw(&value, sizeof(value));
+    }
+    template <typename Enum>
+      requires std::is_enum_v<Enum>
+    void process(Enum value) {
+      process(static_cast<std::uint32_t>(value));
+    }
+    template <typename Value>
+      requires std::is_class_v<Value>
+    void process(const Value &value) {
+      fields(*this, value);
+    }
+    void process(const std::string &value) {
+      process(static_cast<std::uint64_t>(value.size()));
+      raw(value.data(), value.size());
+    }
+    template <typename Value>
+    void process(const std::vector<Value> &values) {
+      process(static_cast<std::uint64_t>(values.size()));
+      for (const auto &value : values) {
+        process(value);
+      }
+    }
+    template <typename Value>
+    void process(const std::optional<Value> &value) {
+      process(value.has_value());
+      if (value) {
+        process(*value);
+      }
+    }
+    template <typename... Types>
+    void process(const std::variant<Types...> &value) {
+      process(static_cast<std::uint32_t>(value.index()));
+      std::visit([this](const auto &alternative) { process(alternative); },
+                 value);
+    }
+    template <typename... Types>
+    void process(const detail::Impl<Types...> &impl) {
+      using Variant = typename detail::Impl<Types...>::ValueT;
+      impl.visit([this](const auto &alternative) {
+        process(Alternative<std::remove_cvref_t<decltype(alternative)>,
+                            Variant>::value);
+        process(alternative);
+      });
+    }
+    void process(const object::Object &object) {
+      if (object.dir_size() != 0) {
+        throw std::runtime_error("constant with attributes");
+      }
+      object.visit([this](const auto &value) { constant(value); });
+    }
+    void constant(const object::Bytes &value) {
+      process(Constant::BYTES);
+      process(value);
+    }
+    void constant(const object::Number &value) {
+      if (value.is_nan()) {
+        throw std::runtime_error("constant NaN");
+      }
+      std::ostringstream repr;
+      value.repr(static_cast<std::ostream &>(repr));
+      process(Constant::NUMBER);
+      process(value.is_complex());
+      process(repr.str());
+    }
+    void constant(const object::String &value) {
+      process(Constant::STRING);
+      process(value);
+    }
+    template <typename Value>
+    void constant(const Value & /*value*/) {
+      throw std::runtime_error("constant has no serialized form");
+    }
+  };
+  struct Reader {
+    static constexpr bool writing = false;
+    template <typename... Values>
+    void operator()(Values &...values) {
+      (process(values), ...);
+    }
+    std::string_view input;
+
+  private:
+    [[noreturn]] static void malformed() {
+      throw std::runtime_error("malformed serialized module");
+    }
+    void raw(void *data, std::size_t size) {
+      if (size > input.size()) {
+        malformed();
+      }
+      std::memcpy(data, input.data(), size);
+      input.remove_prefix(size);
+    }
+    template <typename Integral>
+    [[nodiscard]] auto read() -> Integral {
+      Integral value{};
+      raw(&value, sizeof(value));
+      return value;
+    }
+    [[nodiscard]] auto read_size() -> std::size_t {
+      auto size = read<std::uint64_t>();
+      if (size > input.size()) {
+        malformed();
+      }
+      return size;
+    }
+    void process(bool &value) { value = read<std::uint8_t>() != 0; }
+    template <typename Integral>
+      requires std::is_integral_v<Integral>
+    void process(Integral &value) {
+      value = read<Integral>();
+    }
+    template <typename Enum>
+      requires std::is_enum_v<Enum>
+    void process(Enum &value) {
+      value = static_cast<Enum>(read<std::uint32_t>());
+    }
+    template <typename Value>
+      requires std::is_class_v<Value>
+    void process(Value &value) {
+      fields(*this, value);
+    }
+    void process(std::string &value) {
+      auto size = read_size();
+      value.assign(input.substr(0, size));
+      input.remove_prefix(size);
+    }
+    template <typename Value>
+    void process(std::vector<Value> &values) {
+      auto size = read_size();
+      values.clear();
+      values.reserve(size);
+      for (; size > 0; --size) {
+        process(values.emplace_back());
+      }
+    }
+    template <typename Value>
+    void process(std::optional<Value> &value) {
+      value.reset();
+      if (read<std::uint8_t>() != 0) {
+        process(value.emplace());
+      }
+    }
+    template <typename... Types>
+    void process(std::variant<Types...> &value) {
+      alternative<std::variant<Types...>>(value);
+    }
+    template <typename... Types>
+    void process(detail::Impl<Types...> &impl) {
+      alternative<typename detail::Impl<Types...>::ValueT>(impl);
+    }
+    template <typename Variant, typename Target>
+    void alternative(Target &target) {
+      auto index = read<std::uint32_t>();
+      if (index >= std::variant_size_v<Variant>) {
+        malformed();
+      }
+      using Indices = std::make_index_sequence<std::variant_size_v<Variant>>;
+      alternative<Variant>(target, index, Indices{});
+    }
+    template <typename Variant, typename Target, std::size_t... Indices>
+    void alternative(Target &target, std::uint32_t index,
+                     std::index_sequence<Indices...> /*indices*/) {
+      static_cast<void>(
+          ((index == Indices &&
+            (assign<std::variant_alternative_t<Indices, Variant>>(target),
+             true)) ||
+           ...));
+    }
+    template <typename Type, typename Target>
+    void assign(Target &target) {
+      Type value{};
+      process(value);
+      target = std::move(value);
+    }
+    void process(object::Object &object) {
+      switch (read<std::uint32_t>()) {
+        case static_cast<std::uint32_t>(Constant::BYTES): {
+          object::Bytes value;
+          process(value);
+          object = object::Object(std::move(value), {});
+          return;
+        }
+        case static_cast<std::uint32_t>(Constant::NUMBER): {
+          auto complex = read<std::uint8_t>() != 0;
+          std::string repr;
+          process(repr);
+          object = object::Object(number(complex, repr), {});
+          return;
+        }
+        case static_cast<std::uint32_t>(Constant::STRING): {
+          object::String value;
+          process(value);
+          object = object::Object(std::move(value), {});
+          return;
+        }
+        default:
+          malformed();
+      }
+    }
+    //! inverse of Number::repr, "n", "-n", "n/d", and "a + bi" for complex
+    [[nodiscard]] static auto number(bool complex, std::string_view repr)
+        -> object::Number {
+      if (!complex) {
+        return real(repr);
+      }
+      auto plus = repr.find(" + "sv);
+      if (plus == std::string_view::npos) {
+        return real(repr).imag();
+      }
+      if (!repr.ends_with('i')) {
+        malformed();
+      }
+      auto imag = repr.substr(plus + 3);
+      imag.remove_suffix(1);
+      return real(repr.substr(0, plus)) + real(imag).imag();
+    }
+    [[nodiscard]] static auto real(std::string_view repr) -> object::Number {
+      auto negative = repr.starts_with('-');
+      if (negative) {
+        repr.remove_prefix(1);
+      }
+      auto slash = repr.find('/');
+      auto value = natural(repr.substr(0, slash));
+      if (slash != std::string_view::npos) {
+        value /= natural(repr.substr(slash + 1));
+      }
+      return negative ? -value : value;
+    }
+    [[nodiscard]] static auto natural(std::string_view digits)
+        -> object::Number {
+      static constexpr std::size_t chunk = 18;
+      if (digits.empty()) {
+        malformed();
+      }
+      auto value = object::Number(0U);
+      while (!digits.empty()) {
+        auto part = digits.substr(0, chunk);
+        std::uint64_t parsed = 0;
+        auto [end, error] =
+            std::from_chars(part.data(), part.data() + part.size(), parsed);
+        if (error != std::errc{} || end != part.data() + part.size()) {
+          malformed();
+        }
+        value *= object::Number(10U).pow(object::Number(part.size()));
+        value += object::Number(parsed);
+        digits.remove_prefix(part.size());
+      }
+      return value;
+    }
+  };
+  [[nodiscard]] auto serialize(const Module &module) -> std::string {
+    Writer writer;
+    writer(module.iter(), module.doc());
+    return std::move(writer.output);
+  }
+  [[nodiscard]] auto deserialize(std::string_view data) -> Module {
+    auto arena = std::make_shared<container::Arena>();
+    Reader reader{data};
+    std::vector<StmtImpl> body;
+    std::optional<DocString> doc_string;
+    {
+      const container::Arena::Use nodes(*arena);
+      reader(body, doc_string);
+    }
+    if (!reader.input.empty()) {
+      throw std::runtime_error("malformed serialized module");
+    }
+    return {std::move(arena), std::move(body), std::move(doc_string)};
+  }
+} // namespace chimera::library::asdl
@@ -0,0 +1,15 @@
+//! binary form of a parsed module for the compiled code cache
+
+#pragma once
+
+#include "asdl/asdl.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace chimera::library::asdl {
+  //! throws std::runtime_error for constants with no stable encoding
+  [[nodiscard]] auto serialize(const Module &module) -> std::string;
+  //! throws std::runtime_error when the data is truncated or malformed
+  [[nodiscard]] auto deserialize(std::string_view data) -> Module;
+} // namespace chimera::library::asdl
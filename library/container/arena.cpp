@@ -0,0 +1,68 @@
+//! bump allocation for values that all die together
+
+#include "container/arena.hpp"
+
+#include <algorithm> // for max, min
+#include <cstddef>   // for size_t, byte, max_align_t
+#include <cstdint>   // for uintptr_t
+#include <new>       // for operator new, align_val_t
+#include <utility>   // for exchange
+
+namespace chimera::library::container {
+  //! small trees stay in one block, large ones double up to the largest
+  static constexpr std::size_t firstBlock = 4U * 1024U;
+  static constexpr std::size_t largestBlock = 64U * 1024U;
+  struct alignas(std::max_align_t) Arena::Block {
+    Block *next;
+    std::size_t size;
+  };
+  static thread_local Arena *currentArena = nullptr;
+  Arena::Use::Use(Arena &arena) noexcept
+      : previous(std::exchange(currentArena, &arena)) {}
+  Arena::Use::~Use() noexcept { currentArena = previous; }
+  Arena::~Arena() noexcept {
+    for (auto *finalizer = finalizers; finalizer != nullptr;
+         finalizer = finalizer->next) {
+      finalizer->destroy(finalizer->value);
+    }
+    while (blocks != nullptr) {
+      auto *block = std::exchange(blocks, blocks->next);
+      ::operator delete(block, block->size,
+                        std::align_val_t{alignof(Block)});
+    }
+  }
+  [[nodiscard]] auto Arena::current() noexcept -> Arena * {
+    return currentArena;
+  }
+  [[nodiscard]] auto Arena::allocate(std::size_t size, std::size_t alignment)
+      -> void * {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto address = reinterpret_cast<std::uintptr_t>(next);
+    auto padding = (alignment - address % alignment) % alignment;
+    if (next == nullptr ||
+        static_cast<std::size_t>(end - next) < padding + size) {
+      refill(size, alignment);
+      padding = 0;
+    }
+    auto *memory = next + padding;
+    next = memory + size;
+    return memory;
+  }
+  //! a fresh block that fits size, blocks after the first double in size
+  void Arena::refill(std::size_t size, std::size_t alignment) {
+    auto grown = blocks == nullptr ? firstBlock
+                                   : std::min(blocks->size * 2, largestBlock);
+    auto needed = sizeof(Block) + size + std::max(alignment, alignof(Block));
+    auto total = std::max(grown, needed);
+    auto *block = static_cast<Block *>(
+        ::operator new(total, std::align_val_t{alignof(Block)}));
+    blocks = std::construct_at(block, blocks, total);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    next = reinterpret_cast<std::byte *>(block) + sizeof(Block);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto address = reinterpret_cast<std::uintptr_t>(next);
+    next += (alignment - address % alignment) % alignment;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    end = reinterpret_cast<std::byte *>(block) + total;
+  }
+} // namespace chimera::library::container
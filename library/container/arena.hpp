@@ -0,0 +1,72 @@
+//! bump allocation for values that all die together
+
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <memory>      // for construct_at, destroy_at
+#include <type_traits> // for is_trivially_destructible_v
+#include <utility>     // for forward
+
+namespace chimera::library::container {
+  //! memory for one tree of values, nothing is freed until the arena is,
+  //! then every value is destroyed in reverse order of creation
+  class Arena {
+  public:
+    //! makes an arena the calling thread's current one for its lifetime
+    class Use {
+    public:
+      explicit Use(Arena &arena) noexcept;
+      Use(const Use &other) = delete;
+      Use(Use &&other) = delete;
+      ~Use() noexcept;
+      auto operator=(const Use &other) -> Use & = delete;
+      auto operator=(Use &&other) -> Use & = delete;
+
+    private:
+      Arena *previous;
+    };
+    Arena() noexcept = default;
+    Arena(const Arena &other) = delete;
+    Arena(Arena &&other) = delete;
+    ~Arena() noexcept;
+    auto operator=(const Arena &other) -> Arena & = delete;
+    auto operator=(Arena &&other) -> Arena & = delete;
+    //! the arena of the innermost live Use on this thread, if any
+    [[nodiscard]] static auto current() noexcept -> Arena *;
+    template <typename Type, typename... Args>
+    [[nodiscard]] auto make(Args &&...args) -> Type * {
+      if constexpr (std::is_trivially_destructible_v<Type>) {
+        return std::construct_at(
+            static_cast<Type *>(allocate(sizeof(Type), alignof(Type))),
+            std::forward<Args>(args)...);
+      } else {
+        auto *finalizer = static_cast<Finalizer *>(
+            allocate(sizeof(Finalizer), alignof(Finalizer)));
+        auto *value = std::construct_at(
+            static_cast<Type *>(allocate(sizeof(Type), alignof(Type))),
+            std::forward<Args>(args)...);
+        finalizers = std::construct_at(finalizer, finalizers, value,
+                                       [](void *finalized) noexcept {
+                                         std::destroy_at(
+                                             static_cast<Type *>(finalized));
+                                       });
+        return value;
+      }
+    }
+    [[nodiscard]] auto allocate(std::size_t size, std::size_t alignment)
+        -> void *;
+
+  private:
+    struct Block;
+    struct Finalizer {
+      Finalizer *next;
+      void *value;
+      void (*destroy)(void *value) noexcept;
+    };
+    void refill(std::size_t size, std::size_t alignment);
+    Block *blocks = nullptr;
+    Finalizer *finalizers = nullptr;
+    std::byte *next = nullptr;
+    std::byte *end = nullptr;
+  };
+} // namespace chimera::library::container
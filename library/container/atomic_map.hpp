@@ -4,10 +4,13 @@
 
 #include "container/atomic_container.hpp" // for AtomicContainer
 
-#include <map>     // for map
-#include <utility> // for forward
+#include <map>      // for map
+#include <optional> // for optional
+#include <utility>  // for forward, pair
 
 namespace chimera::library::container {
+  //! lookups copy the value out under the lock, nothing returned refers into
+  //! the map once the lock is released, hold read() or write() for longer
   template <typename Key, typename Value>
   struct AtomicMap : AtomicContainer<std::map<Key, Value>> {
     using Container = AtomicContainer<std::map<Key, Value>>;
@@ -15,22 +18,10 @@ namespace chimera::library::container {
     using Container::read;
     using Container::write;
     template <typename... Args>
-    [[nodiscard]] auto at(Args &&...args) const -> auto & {
+    [[nodiscard]] auto at(Args &&...args) const -> Value {
       return read().value.at(std::forward<Args>(args)...);
     }
     template <typename... Args>
-    [[nodiscard]] auto at(Args &&...args) -> auto & {
-      return read().value.at(std::forward<Args>(args)...);
-    }
-    template <typename... Args>
-    [[nodiscard]] auto cbegin(Args &&...args) const {
-      return read().value.cbegin(std::forward<Args>(args)...);
-    }
-    template <typename... Args>
-    [[nodiscard]] auto cend(Args &&...args) const {
-      return read().value.cend(std::forward<Args>(args)...);
-    }
-    template <typename... Args>
     [[nodiscard]] auto contains(Args &&...args) const {
       return Container::read().value.contains(std::forward<Args>(args)...);
     }
@@ -38,15 +29,19 @@ namespace chimera::library::container {
     [[nodiscard]] auto count(Args &&...args) const {
       return read().value.count(std::forward<Args>(args)...);
     }
+    template <typename Lookup>
+    [[nodiscard]] auto find(const Lookup &key) const -> std::optional<Value> {
+      auto read = this->read();
+      if (auto found = read.value.find(key); found != read.value.end()) {
+        return found->second;
+      }
+      return {};
+    }
     template <typename... Args>
     [[nodiscard]] auto size(Args &&...args) const {
       return read().value.size(std::forward<Args>(args)...);
     }
     template <typename... Args>
-    [[nodiscard]] auto operator[](Args &&...args) -> auto & {
-      return write().value.operator[](std::forward<Args>(args)...);
-    }
-    template <typename... Args>
     void erase(Args &&...args) {
       write().value.erase(std::forward<Args>(args)...);
     }
@@ -54,9 +49,13 @@ namespace chimera::library::container {
     void insert_or_assign(Args &&...args) {
       write().value.insert_or_assign(std::forward<Args>(args)...);
     }
+    //! the stored value, and whether it was inserted by this call
     template <typename... Args>
-    [[nodiscard]] auto try_emplace(Args &&...args) {
-      return write().value.try_emplace(std::forward<Args>(args)...);
+    [[nodiscard]] auto try_emplace(Args &&...args) -> std::pair<Value, bool> {
+      auto write = this->write();
+      auto [found, inserted] =
+          write.value.try_emplace(std::forward<Args>(args)...);
+      return {found->second, inserted};
     }
   };
 } // namespace chimera::library::container
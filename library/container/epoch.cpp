@@ -0,0 +1,187 @@
+//! epoch based reclamation for lock free readers
+
+#include "container/epoch.hpp"
+
+#include <algorithm> // for all_of, find_if, partition
+#include <atomic>    // for atomic, atomic_thread_fence
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint64_t
+#include <deque>     // for deque
+#include <mutex>     // for lock_guard, mutex
+#include <thread>    // for yield
+#include <utility>   // for exchange
+#include <vector>    // for vector
+
+namespace chimera::library::container {
+  //! retire this many pointers on a thread before trying to free any
+  static constexpr std::size_t reclaimBatch = 64;
+  //! one per thread, padded so announcing a read never shares a cache line
+  struct alignas(64) Participant {
+    //! epoch the thread entered its read section in, zero when outside one
+    std::atomic<std::uint64_t> epoch{0};
+    //! guarded by the registry mutex
+    bool claimed = false;
+  };
+  struct Retired {
+    const void *pointer;
+    Deleter deleter;
+    std::uint64_t epoch;
+  };
+  struct Registry {
+    std::atomic<std::uint64_t> epoch{1};
+    std::mutex mutex;
+    std::deque<Participant> participants;
+    //! retired memory handed over by threads that exited
+    std::vector<Retired> orphans;
+  };
+  static auto registry() -> Registry & {
+    //! never destroyed so threads that outlive main can still check out
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    static auto *shared = new Registry();
+    return *shared;
+  }
+  //! moves the epoch forward once every reader has seen the current one,
+  //! caller holds the registry mutex
+  static auto advance(Registry &shared) -> std::uint64_t {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto current = shared.epoch.load(std::memory_order_relaxed);
+    if (std::all_of(shared.participants.begin(), shared.participants.end(),
+                    [current](const auto &other) {
+                      auto epoch = other.epoch.load(std::memory_order_acquire);
+                      return epoch == 0 || epoch == current;
+                    })) {
+      current = shared.epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+    }
+    return current;
+  }
+  class Local {
+  public:
+    Local() = default;
+    Local(const Local &other) = delete;
+    Local(Local &&other) = delete;
+    //! hands anything still waiting to the next thread that collects
+    ~Local() noexcept {
+      if (participant == nullptr) {
+        return;
+      }
+      auto &shared = registry();
+      const std::lock_guard<std::mutex> lock(shared.mutex);
+      shared.orphans.insert(shared.orphans.end(), limbo.begin(), limbo.end());
+      participant->epoch.store(0, std::memory_order_release);
+      participant->claimed = false;
+    }
+    auto operator=(const Local &other) -> Local & = delete;
+    auto operator=(Local &&other) -> Local & = delete;
+    void enter() {
+      if (depth != 0) {
+        ++depth;
+        return;
+      }
+      auto &shared = registry();
+      if (participant == nullptr) {
+        claim(shared);
+      }
+      ++depth;
+      participant->epoch.store(shared.epoch.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+    void exit() noexcept {
+      if (--depth == 0) {
+        participant->epoch.store(0, std::memory_order_release);
+      }
+    }
+    void retire(const void *pointer, Deleter deleter) {
+      limbo.push_back(
+          {pointer, deleter, registry().epoch.load(std::memory_order_seq_cst)});
+      if (limbo.size() >= reclaimBatch) {
+        collect();
+      }
+    }
+    //! memory is freed two epochs after it was retired
+    void reclaim() {
+      collect();
+      collect();
+    }
+
+  private:
+    void claim(Registry &shared) {
+      const std::lock_guard<std::mutex> lock(shared.mutex);
+      auto found =
+          std::find_if(shared.participants.begin(), shared.participants.end(),
+                       [](const auto &other) { return !other.claimed; });
+      participant = found == shared.participants.end()
+                        ? &shared.participants.emplace_back()
+                        : &*found;
+      participant->claimed = true;
+    }
+    //! advance the epoch if every reader has seen it, then free whatever
+    //! was retired at least two epochs ago
+    void collect() {
+      auto &shared = registry();
+      std::uint64_t current = 0;
+      {
+        const std::lock_guard<std::mutex> lock(shared.mutex);
+        limbo.insert(limbo.end(), shared.orphans.begin(), shared.orphans.end());
+        shared.orphans.clear();
+        current = advance(shared);
+      }
+      auto ready =
+          std::partition(limbo.begin(), limbo.end(), [current](auto &retired) {
+            return retired.epoch + 2 > current;
+          });
+      const std::vector<Retired> expired(ready, limbo.end());
+      limbo.erase(ready, limbo.end());
+      for (const auto &retired : expired) {
+        retired.deleter(retired.pointer);
+      }
+    }
+    Participant *participant = nullptr;
+    std::size_t depth = 0;
+    std::vector<Retired> limbo;
+  };
+  //! heap allocated so guards taken while thread locals are destroyed still
+  //! find a record, those late records are simply never freed
+  static thread_local Local *thread = nullptr;
+  struct Checkout {
+    Checkout() noexcept = default;
+    Checkout(const Checkout &other) = delete;
+    Checkout(Checkout &&other) = delete;
+    ~Checkout() noexcept {
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      delete std::exchange(thread, nullptr);
+    }
+    auto operator=(const Checkout &other) -> Checkout & = delete;
+    auto operator=(Checkout &&other) -> Checkout & = delete;
+  };
+  static auto local() -> Local & {
+    if (thread == nullptr) {
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      thread = new Local();
+      thread_local const Checkout checkout;
+    }
+    return *thread;
+  }
+  EpochGuard::EpochGuard() { local().enter(); }
+  EpochGuard::~EpochGuard() noexcept { local().exit(); }
+  void retire(const void *pointer, Deleter deleter) {
+    local().retire(pointer, deleter);
+  }
+  //! a reader that entered before the epoch reached target would block the
+  //! advance past it, so two advances mean all of them have left
+  void synchronize() {
+    auto &shared = registry();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto target = shared.epoch.load(std::memory_order_seq_cst) + 2;
+    while (true) {
+      {
+        const std::lock_guard<std::mutex> lock(shared.mutex);
+        if (advance(shared) >= target) {
+          return;
+        }
+      }
+      std::this_thread::yield();
+    }
+  }
+  void reclaim() { local().reclaim(); }
+} // namespace chimera::library::container
@@ -0,0 +1,34 @@
+//! epoch based reclamation for lock free readers
+
+#pragma once
+
+namespace chimera::library::container {
+  //! marks a read section, memory retired while any guard that might have
+  //! seen it is alive is only freed after that guard is destroyed, the first
+  //! guard on a thread allocates its record
+  class EpochGuard {
+  public:
+    EpochGuard();
+    EpochGuard(const EpochGuard &other) = delete;
+    EpochGuard(EpochGuard &&other) = delete;
+    ~EpochGuard() noexcept;
+    auto operator=(const EpochGuard &other) -> EpochGuard & = delete;
+    auto operator=(EpochGuard &&other) -> EpochGuard & = delete;
+  };
+  //! blocks until every read section open when it was called has ended, the
+  //! caller must not be inside one itself
+  void synchronize();
+  //! frees whatever the calling thread retired that readers can no longer see
+  void reclaim();
+  using Deleter = void (*)(const void *);
+  //! free pointer with deleter once no reader can still observe it, pointer
+  //! must already be unreachable for new readers
+  void retire(const void *pointer, Deleter deleter);
+  template <typename Type>
+  void retire(const Type *pointer) {
+    retire(static_cast<const void *>(pointer), [](const void *retired) {
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      delete static_cast<const Type *>(retired);
+    });
+  }
+} // namespace chimera::library::container
@@ -0,0 +1,159 @@
+//! open addressing hash map with densely packed entries
+
+#pragma once
+
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
+#include <functional> // for hash
+#include <limits>     // for numeric_limits
+#include <stdexcept>  // for out_of_range
+#include <tuple>      // for forward_as_tuple
+#include <utility>    // for move, pair, piecewise_construct
+#include <vector>     // for vector
+
+namespace chimera::library::container {
+  //! entries live contiguously for iteration and the probe table only holds
+  //! their indexes, lookups are linear probes and erase shifts the run back
+  //! so there are never any tombstones
+  template <typename Key, typename Value, typename Hash = std::hash<Key>>
+  class FlatMap {
+  public:
+    using value_type = std::pair<Key, Value>;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+    FlatMap() = default;
+    template <typename Iterator>
+    FlatMap(Iterator first, Iterator last) {
+      for (; first != last; ++first) {
+        auto &&entry = *first;
+        insert_or_assign(Key(entry.first),
+                         std::forward<decltype(entry)>(entry).second);
+      }
+    }
+    [[nodiscard]] auto at(const Key &key) const -> const Value & {
+      if (const auto *value = find(key); value != nullptr) {
+        return *value;
+      }
+      throw std::out_of_range("FlatMap::at");
+    }
+    [[nodiscard]] auto at(const Key &key) -> Value & {
+      if (auto *value = find(key); value != nullptr) {
+        return *value;
+      }
+      throw std::out_of_range("FlatMap::at");
+    }
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+      return entries.cbegin();
+    }
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+      return entries.cend();
+    }
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+      return entries.cbegin();
+    }
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+      return entries.cend();
+    }
+    [[nodiscard]] auto contains(const Key &key) const -> bool {
+      return find(key) != nullptr;
+    }
+    [[nodiscard]] auto count(const Key &key) const -> std::size_t {
+      return contains(key) ? 1 : 0;
+    }
+    [[nodiscard]] auto empty() const noexcept -> bool {
+      return entries.empty();
+    }
+    [[nodiscard]] auto size() const noexcept -> std::size_t {
+      return entries.size();
+    }
+    [[nodiscard]] auto find(const Key &key) const -> const Value * {
+      if (slots.empty()) {
+        return nullptr;
+      }
+      auto slot = slots[probe(key)];
+      return slot == emptySlot ? nullptr : &entries[slot].second;
+    }
+    [[nodiscard]] auto find(const Key &key) -> Value * {
+      const auto &self = *this;
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      return const_cast<Value *>(self.find(key));
+    }
+    auto erase(const Key &key) -> std::size_t {
+      if (slots.empty()) {
+        return 0;
+      }
+      auto hole = probe(key);
+      auto entry = slots[hole];
+      if (entry == emptySlot) {
+        return 0;
+      }
+      auto mask = slots.size() - 1;
+      for (auto next = (hole + 1) & mask; slots[next] != emptySlot;
+           next = (next + 1) & mask) {
+        auto home = Hash{}(entries[slots[next]].first) & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+          slots[hole] = slots[next];
+          hole = next;
+        }
+      }
+      slots[hole] = emptySlot;
+      if (auto last = entries.size() - 1; entry != last) {
+        slots[probe(entries[last].first)] = entry;
+        entries[entry] = std::move(entries[last]);
+      }
+      entries.pop_back();
+      return 1;
+    }
+    template <typename Type>
+    void insert_or_assign(const Key &key, Type &&value) {
+      if (auto *found = find(key); found != nullptr) {
+        *found = std::forward<Type>(value);
+        return;
+      }
+      emplace(key, std::forward<Type>(value));
+    }
+    template <typename... Args>
+    auto try_emplace(const Key &key, Args &&...args)
+        -> std::pair<Value *, bool> {
+      if (auto *found = find(key); found != nullptr) {
+        return {found, false};
+      }
+      return {&emplace(key, std::forward<Args>(args)...), true};
+    }
+    [[nodiscard]] auto operator[](const Key &key) -> Value & {
+      return *try_emplace(key).first;
+    }
+
+  private:
+    static constexpr auto emptySlot =
+        std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::size_t minimumSlots = 8;
+    //! index of the slot holding key, or of the empty slot ending its run
+    [[nodiscard]] auto probe(const Key &key) const -> std::size_t {
+      auto mask = slots.size() - 1;
+      for (auto slot = Hash{}(key) & mask;; slot = (slot + 1) & mask) {
+        if (slots[slot] == emptySlot || entries[slots[slot]].first == key) {
+          return slot;
+        }
+      }
+    }
+    template <typename... Args>
+    auto emplace(const Key &key, Args &&...args) -> Value & {
+      if ((entries.size() + 1) * 2 > slots.size()) {
+        rehash(slots.empty() ? minimumSlots : slots.size() * 2);
+      }
+      slots[probe(key)] = static_cast<std::uint32_t>(entries.size());
+      return entries
+          .emplace_back(std::piecewise_construct, std::forward_as_tuple(key),
+                        std::forward_as_tuple(std::forward<Args>(args)...))
+          .second;
+    }
+    void rehash(std::size_t size) {
+      slots.assign(size, emptySlot);
+      for (std::uint32_t entry = 0; entry < entries.size(); ++entry) {
+        slots[probe(entries[entry].first)] = entry;
+      }
+    }
+    std::vector<value_type> entries;
+    std::vector<std::uint32_t> slots;
+  };
+} // namespace chimera::library::container
@@ -0,0 +1,42 @@
+//! read only memory mapping of a whole file
+
+#include "container/mapped_file.hpp"
+
+#include <fcntl.h>    // for open, O_RDONLY, O_CLOEXEC
+#include <sys/mman.h> // for mmap, munmap
+#include <sys/stat.h> // for fstat
+#include <unistd.h>   // for close
+
+#include <cstddef>     // for size_t
+#include <string_view> // for string_view
+
+namespace chimera::library::container {
+  MappedFile::MappedFile(const char *path) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    auto descriptor = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0) {
+      return;
+    }
+    struct stat status {};
+    if (::fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) &&
+        status.st_size > 0) {
+      auto length = static_cast<std::size_t>(status.st_size);
+      auto *mapped =
+          ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+      if (mapped != MAP_FAILED) {
+        data = mapped;
+        size = length;
+      }
+    }
+    ::close(descriptor);
+  }
+  MappedFile::~MappedFile() noexcept {
+    if (data != nullptr) {
+      ::munmap(data, size);
+    }
+  }
+  [[nodiscard]] auto MappedFile::view() const noexcept -> std::string_view {
+    return {static_cast<const char *>(data), size};
+  }
+} // namespace chimera::library::container
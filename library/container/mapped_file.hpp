@@ -0,0 +1,24 @@
+//! read only memory mapping of a whole file
+
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <string_view> // for string_view
+
+namespace chimera::library::container {
+  //! read only view of a whole file, empty when it cannot be mapped
+  class MappedFile {
+  public:
+    explicit MappedFile(const char *path) noexcept;
+    MappedFile(const MappedFile &other) = delete;
+    MappedFile(MappedFile &&other) noexcept = delete;
+    ~MappedFile() noexcept;
+    auto operator=(const MappedFile &other) -> MappedFile & = delete;
+    auto operator=(MappedFile &&other) noexcept -> MappedFile & = delete;
+    [[nodiscard]] auto view() const noexcept -> std::string_view;
+
+  private:
+    void *data = nullptr;
+    std::size_t size = 0;
+  };
+} // namespace chimera::library::container
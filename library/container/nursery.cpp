@@ -0,0 +1,133 @@
+//! thread local bump allocation for short lived objects
+
+#include "container/nursery.hpp"
+
+#include <atomic>  // for atomic
+#include <cstddef> // for size_t, byte, max_align_t
+#include <cstdint> // for uintptr_t
+#include <cstdlib> // for aligned_alloc, free
+#include <memory>  // for construct_at, destroy_at
+#include <new>     // for bad_alloc, align_val_t
+#include <utility> // for exchange
+
+namespace chimera::library::container {
+  //! chunks are aligned to their size so any allocation finds its header
+  static constexpr std::size_t chunkSize = 32U * 1024U;
+  //! anything bigger would waste most of a chunk when it outlives the rest
+  static constexpr std::size_t largest = 1024;
+  static constexpr std::size_t granule = alignof(std::max_align_t);
+  struct alignas(granule) Chunk {
+    //! live allocations, plus one while a thread still bumps through it
+    std::atomic<std::size_t> live{1};
+  };
+  [[nodiscard]] static auto direct(std::size_t size,
+                                   std::size_t alignment) noexcept -> bool {
+    return size > largest || alignment > granule;
+  }
+  [[nodiscard]] static auto round(std::size_t size) noexcept -> std::size_t {
+    return (size + granule - 1) & ~(granule - 1);
+  }
+  static void release(Chunk *chunk) noexcept {
+    if (chunk->live.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::destroy_at(chunk);
+      // NOLINTNEXTLINE(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+      std::free(chunk);
+    }
+  }
+  class Nursery {
+  public:
+    Nursery() noexcept = default;
+    Nursery(const Nursery &other) = delete;
+    Nursery(Nursery &&other) = delete;
+    //! survivors keep the chunk until the last of them is freed
+    ~Nursery() noexcept {
+      if (chunk != nullptr) {
+        release(chunk);
+      }
+    }
+    auto operator=(const Nursery &other) -> Nursery & = delete;
+    auto operator=(Nursery &&other) -> Nursery & = delete;
+    [[nodiscard]] auto allocate(std::size_t size) -> void * {
+      size = round(size);
+      if (chunk == nullptr ||
+          static_cast<std::size_t>(end - next) < size) {
+        refill();
+      }
+      chunk->live.fetch_add(1, std::memory_order_relaxed);
+      return std::exchange(next, next + size);
+    }
+    void reset() noexcept {
+      if (chunk != nullptr &&
+          chunk->live.load(std::memory_order_acquire) == 1) {
+        next = start();
+      }
+    }
+
+  private:
+    void refill() {
+      // NOLINTNEXTLINE(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+      auto *memory = std::aligned_alloc(chunkSize, chunkSize);
+      if (memory == nullptr) {
+        throw std::bad_alloc();
+      }
+      if (chunk != nullptr) {
+        release(chunk);
+      }
+      chunk = std::construct_at(static_cast<Chunk *>(memory));
+      next = start();
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      end = reinterpret_cast<std::byte *>(chunk) + chunkSize;
+    }
+    [[nodiscard]] auto start() const noexcept -> std::byte * {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      return reinterpret_cast<std::byte *>(chunk) + round(sizeof(Chunk));
+    }
+    Chunk *chunk = nullptr;
+    std::byte *next = nullptr;
+    std::byte *end = nullptr;
+  };
+  //! heap allocated so allocations made while thread locals are destroyed
+  //! still find a nursery, those late nurseries are simply never freed
+  static thread_local Nursery *thread = nullptr;
+  struct NurseryCheckout {
+    NurseryCheckout() noexcept = default;
+    NurseryCheckout(const NurseryCheckout &other) = delete;
+    NurseryCheckout(NurseryCheckout &&other) = delete;
+    ~NurseryCheckout() noexcept {
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      delete std::exchange(thread, nullptr);
+    }
+    auto operator=(const NurseryCheckout &other) -> NurseryCheckout & = delete;
+    auto operator=(NurseryCheckout &&other) -> NurseryCheckout & = delete;
+  };
+  static auto local() -> Nursery & {
+    if (thread == nullptr) {
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      thread = new Nursery();
+      thread_local const NurseryCheckout checkout;
+    }
+    return *thread;
+  }
+  [[nodiscard]] auto nursery_allocate(std::size_t size, std::size_t alignment)
+      -> void * {
+    if (direct(size, alignment)) {
+      return ::operator new(size, std::align_val_t{alignment});
+    }
+    return local().allocate(size);
+  }
+  void nursery_deallocate(void *pointer, std::size_t size,
+                          std::size_t alignment) noexcept {
+    if (direct(size, alignment)) {
+      ::operator delete(pointer, size, std::align_val_t{alignment});
+      return;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+    release(reinterpret_cast<Chunk *>(reinterpret_cast<std::uintptr_t>(pointer) &
+                                      ~(chunkSize - 1)));
+  }
+  void nursery_reset() noexcept {
+    if (thread != nullptr) {
+      thread->reset();
+    }
+  }
+} // namespace chimera::library::container
@@ -0,0 +1,44 @@
+//! thread local bump allocation for short lived objects
+
+#pragma once
+
+#include <cstddef> // for size_t
+#include <limits>  // for numeric_limits
+#include <new>     // for bad_array_new_length
+
+namespace chimera::library::container {
+  //! memory from the calling thread's current chunk, chunks are freed once
+  //! every allocation in them is gone no matter which thread frees it
+  [[nodiscard]] auto nursery_allocate(std::size_t size, std::size_t alignment)
+      -> void *;
+  void nursery_deallocate(void *pointer, std::size_t size,
+                          std::size_t alignment) noexcept;
+  //! reuses the calling thread's chunk from the start when nothing allocated
+  //! from it is still alive
+  void nursery_reset() noexcept;
+  //! stateless allocator over the nursery, large or overaligned requests go
+  //! straight to operator new
+  template <typename Type>
+  struct NurseryAllocator {
+    using value_type = Type;
+    NurseryAllocator() noexcept = default;
+    template <typename Other>
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    NurseryAllocator(const NurseryAllocator<Other> & /*other*/) noexcept {}
+    [[nodiscard]] auto allocate(std::size_t count) -> Type * {
+      if (count > std::numeric_limits<std::size_t>::max() / sizeof(Type)) {
+        throw std::bad_array_new_length();
+      }
+      return static_cast<Type *>(
+          nursery_allocate(count * sizeof(Type), alignof(Type)));
+    }
+    void deallocate(Type *pointer, std::size_t count) noexcept {
+      nursery_deallocate(pointer, count * sizeof(Type), alignof(Type));
+    }
+    template <typename Other>
+    [[nodiscard]] auto operator==(const NurseryAllocator<Other> & /*other*/)
+        const noexcept -> bool {
+      return true;
+    }
+  };
+} // namespace chimera::library::container
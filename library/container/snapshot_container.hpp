@@ -0,0 +1,104 @@
+//! copy on write wrapper for a container read far more often than written
+
+#pragma once
+
+#include "container/epoch.hpp" // for EpochGuard, retire
+
+#include <atomic>    // for atomic
+#include <exception> // for uncaught_exceptions
+#include <memory>    // for unique_ptr, make_unique
+#include <mutex>     // for unique_lock, mutex
+#include <utility>   // for forward, move, pair
+#include <vector>    // for vector
+
+namespace chimera::library::container {
+  //! readers take no lock, they load the current snapshot inside an epoch
+  //! guard, writers copy it under a mutex and publish the copy when done,
+  //! changes readers can see piecemeal may update the snapshot in place
+  template <typename Value>
+  struct SnapshotContainer {
+    SnapshotContainer() : snapshot(std::make_unique<Value>().release()) {}
+    template <typename... Args>
+    explicit SnapshotContainer(Args &&...args)
+        : snapshot(
+              std::make_unique<Value>(std::forward<Args>(args)...).release()) {}
+    SnapshotContainer(const SnapshotContainer &other)
+        : snapshot(std::make_unique<Value>(other.read().value).release()) {}
+    SnapshotContainer(SnapshotContainer &&other) = delete;
+    ~SnapshotContainer() noexcept {
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      delete snapshot.load(std::memory_order_relaxed);
+    }
+    auto operator=(const SnapshotContainer &other) -> SnapshotContainer & {
+      if (this != &other) {
+        write().value = other.read().value;
+      }
+      return *this;
+    }
+    auto operator=(SnapshotContainer &&other) -> SnapshotContainer & = delete;
+    // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
+    struct Read {
+      const EpochGuard guard;
+      const Value &value;
+    };
+    struct Write {
+      //! a write abandoned by an exception leaves the published value alone
+      ~Write() noexcept {
+        if (std::uncaught_exceptions() > exceptions) {
+          return;
+        }
+        container::retire(container->snapshot.exchange(
+            copy.release(), std::memory_order_acq_rel));
+        for (const auto &[pointer, deleter] : retired) {
+          container::retire(pointer, deleter);
+        }
+      }
+      //! free pointer once the copy is published and no reader can see it
+      template <typename Type>
+      void retire(const Type *pointer) {
+        retired.emplace_back(pointer, [](const void *old) {
+          // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+          delete static_cast<const Type *>(old);
+        });
+      }
+      const std::unique_lock<std::mutex> lock;
+      SnapshotContainer *container;
+      std::unique_ptr<Value> copy;
+      Value &value;
+      std::vector<std::pair<const void *, Deleter>> retired{};
+      const int exceptions = std::uncaught_exceptions();
+    };
+    //! the published value under the writer lock, only for changes every
+    //! reader sees whole such as storing a single atomic
+    struct Update {
+      //! hands the lock over to a copy for changes readers must not see
+      [[nodiscard]] auto copy() -> Write {
+        return container->write(std::move(lock));
+      }
+      std::unique_lock<std::mutex> lock;
+      SnapshotContainer *container;
+      Value &value;
+    };
+    // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
+    [[nodiscard]] auto read() const -> Read {
+      return Read{{}, *snapshot.load(std::memory_order_acquire)};
+    }
+    [[nodiscard]] auto update() -> Update {
+      return Update{std::unique_lock<std::mutex>(mutex), this,
+                    *snapshot.load(std::memory_order_relaxed)};
+    }
+    [[nodiscard]] auto write() -> Write {
+      return write(std::unique_lock<std::mutex>(mutex));
+    }
+
+  private:
+    [[nodiscard]] auto write(std::unique_lock<std::mutex> &&lock) -> Write {
+      auto copy =
+          std::make_unique<Value>(*snapshot.load(std::memory_order_relaxed));
+      auto &value = *copy;
+      return Write{std::move(lock), this, std::move(copy), value};
+    }
+    std::mutex mutex;
+    std::atomic<Value *> snapshot;
+  };
+} // namespace chimera::library::container
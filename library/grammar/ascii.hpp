@@ -0,0 +1,200 @@
+//! rules that skip runs of plain ASCII many bytes at a time.
+//! each rule only claims bytes below 0x80, anything else is left for the
+//! full unicode rule that follows it
+
+#pragma once
+
+#include "grammar/rules.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h> // for _mm256_*
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h> // for _mm_*
+#endif
+
+#include <bit>         // for countr_one
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint32_t
+#include <type_traits> // for conditional_t
+
+namespace chimera::library::grammar::ascii {
+#if defined(__AVX2__)
+  using Vector = __m256i;
+  [[nodiscard]] inline auto load(const char *data) noexcept -> Vector {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return _mm256_loadu_si256(reinterpret_cast<const Vector *>(data));
+  }
+  [[nodiscard]] inline auto broadcast(char byte) noexcept -> Vector {
+    return _mm256_set1_epi8(byte);
+  }
+  [[nodiscard]] inline auto equal(Vector left, Vector right) noexcept
+      -> Vector {
+    return _mm256_cmpeq_epi8(left, right);
+  }
+  [[nodiscard]] inline auto greater(Vector left, Vector right) noexcept
+      -> Vector {
+    return _mm256_cmpgt_epi8(left, right);
+  }
+  [[nodiscard]] inline auto either(Vector left, Vector right) noexcept
+      -> Vector {
+    return _mm256_or_si256(left, right);
+  }
+  [[nodiscard]] inline auto both(Vector left, Vector right) noexcept
+      -> Vector {
+    return _mm256_and_si256(left, right);
+  }
+  [[nodiscard]] inline auto mask(Vector vector) noexcept -> std::uint32_t {
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(vector));
+  }
+#elif defined(__SSE2__) || defined(_M_X64)
+  using Vector = __m128i;
+  [[nodiscard]] inline auto load(const char *data) noexcept -> Vector {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return _mm_loadu_si128(reinterpret_cast<const Vector *>(data));
+  }
+  [[nodiscard]] inline auto broadcast(char byte) noexcept -> Vector {
+    return _mm_set1_epi8(byte);
+  }
+  [[nodiscard]] inline auto equal(Vector left, Vector right) noexcept
+      -> Vector {
+    return _mm_cmpeq_epi8(left, right);
+  }
+  [[nodiscard]] inline auto greater(Vector left, Vector right) noexcept
+      -> Vector {
+    return _mm_cmpgt_epi8(left, right);
+  }
+  [[nodiscard]] inline auto either(Vector left, Vector right) noexcept
+      -> Vector {
+    return _mm_or_si128(left, right);
+  }
+  [[nodiscard]] inline auto both(Vector left, Vector right) noexcept
+      -> Vector {
+    return _mm_and_si128(left, right);
+  }
+  [[nodiscard]] inline auto mask(Vector vector) noexcept -> std::uint32_t {
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(vector));
+  }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+  static constexpr std::size_t width = sizeof(Vector);
+  //! signed compare, bytes from 0x80 up are negative and never in range
+  [[nodiscard]] inline auto between(Vector bytes, char low, char high) noexcept
+      -> Vector {
+    return both(greater(bytes, broadcast(static_cast<char>(low - 1))),
+                greater(broadcast(static_cast<char>(high + 1)), bytes));
+  }
+#endif
+  //! space, tab, vertical tab and form feed, plus line breaks when implicit
+  template <bool LineBreaks>
+  struct Blank {
+    using Rule =
+        std::conditional_t<LineBreaks, one<' ', '\t', '\v', '\f', '\r', '\n'>,
+                           one<' ', '\t', '\v', '\f'>>;
+    static constexpr bool lineBreaks = LineBreaks;
+    [[nodiscard]] static constexpr auto scalar(char byte) noexcept -> bool {
+      return byte == ' ' || byte == '\t' || byte == '\v' || byte == '\f' ||
+             (LineBreaks && (byte == '\r' || byte == '\n'));
+    }
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    [[nodiscard]] static auto vector(Vector bytes) noexcept -> Vector {
+      auto spaces = equal(bytes, broadcast(' '));
+      if constexpr (LineBreaks) {
+        return either(spaces, between(bytes, '\t', '\r'));
+      } else {
+        return either(either(spaces, equal(bytes, broadcast('\t'))),
+                      between(bytes, '\v', '\f'));
+      }
+    }
+#endif
+  };
+  //! anything a comment may hold up to the end of its line
+  struct CommentChar {
+    using Rule = not_one<'\r', '\n'>;
+    static constexpr bool lineBreaks = false;
+    [[nodiscard]] static constexpr auto scalar(char byte) noexcept -> bool {
+      return static_cast<unsigned char>(byte) < 0x80U && byte != '\r' &&
+             byte != '\n';
+    }
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    [[nodiscard]] static auto vector(Vector bytes) noexcept -> Vector {
+      auto stop = either(greater(broadcast(0), bytes),
+                         either(equal(bytes, broadcast('\r')),
+                                equal(bytes, broadcast('\n'))));
+      return equal(stop, broadcast(0));
+    }
+#endif
+  };
+  //! letters, digits and underscore
+  struct IdentifierChar {
+    using Rule = ranges<'a', 'z', 'A', 'Z', '0', '9', '_'>;
+    static constexpr bool lineBreaks = false;
+    [[nodiscard]] static constexpr auto scalar(char byte) noexcept -> bool {
+      return (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') ||
+             (byte >= '0' && byte <= '9') || byte == '_';
+    }
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    [[nodiscard]] static auto vector(Vector bytes) noexcept -> Vector {
+      auto letters = between(either(bytes, broadcast(0x20)), 'a', 'z');
+      return either(either(letters, between(bytes, '0', '9')),
+                    equal(bytes, broadcast('_')));
+    }
+#endif
+  };
+  //! length of the leading run of data that Class accepts
+  template <typename Class>
+  [[nodiscard]] auto span(const char *data, std::size_t size) noexcept
+      -> std::size_t {
+    std::size_t index = 0;
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    for (; index + width <= size; index += width) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      auto accepted = mask(Class::vector(load(data + index)));
+      if (accepted != (width == 32 ? ~std::uint32_t{} : 0xFFFFU)) {
+        return index + static_cast<std::size_t>(std::countr_one(accepted));
+      }
+    }
+#endif
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    while (index < size && Class::scalar(data[index])) {
+      ++index;
+    }
+    return index;
+  }
+  //! consumes as many accepted bytes as the input holds, refilling a
+  //! buffered input as it goes
+  template <typename Class, typename Input>
+  auto skip(Input &input) -> std::size_t {
+    std::size_t total = 0;
+    for (auto available = input.size(1); available > 0;
+         available = input.size(1)) {
+      auto count = span<Class>(input.current(), available);
+      if constexpr (Class::lineBreaks) {
+        input.bump(count);
+      } else {
+        input.bump_in_this_line(count);
+      }
+      total += count;
+      if (count < available) {
+        break;
+      }
+    }
+    return total;
+  }
+  //! zero or more accepted bytes
+  template <typename Class>
+  struct Star : star<typename Class::Rule> {
+    template <typename Input, typename... Args>
+    static auto match(Input &&input, Args &&.../*args*/) -> bool {
+      static_cast<void>(skip<Class>(input));
+      return true;
+    }
+  };
+  //! one or more accepted bytes
+  template <typename Class>
+  struct Plus : plus<typename Class::Rule> {
+    template <typename Input, typename... Args>
+    static auto match(Input &&input, Args &&.../*args*/) -> bool {
+      return skip<Class>(input) != 0;
+    }
+  };
+} // namespace chimera::library::grammar::ascii
@@ -3,16 +3,18 @@
 #pragma once
 
 #include "asdl/asdl.hpp"
+#include "grammar/ascii.hpp"
 #include "grammar/rules.hpp"
-#include "grammar/utf8_id_continue.hpp"
-#include "grammar/utf8_id_start.hpp"
+#include "grammar/utf8_id.hpp"
 #include "grammar/whitespace.hpp"
 
 namespace chimera::library::grammar {
   namespace token {
     using XidStart = seq<Utf8IdStart>;
     using XidContinue = seq<Utf8IdContinue>;
-    struct Name : seq<XidStart, star<XidContinue>> {};
+    struct Name
+        : seq<XidStart,
+              star<sor<ascii::Plus<ascii::IdentifierChar>, XidContinue>>> {};
     template <>
     struct Action<Name> {
       template <typename Input, typename Stack, typename... Args>
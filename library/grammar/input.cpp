@@ -4,13 +4,16 @@
 #include "grammar/input.hpp"
 
 #include <tao/pegtl/istream_input.hpp> // for istream_input
+#include <tao/pegtl/memory_input.hpp>  // for memory_input
 
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <iterator>
 #include <limits>
 #include <sstream>
 #include <stack>
+#include <string_view>
 
 using namespace std::literals;
 
@@ -24,8 +27,11 @@ namespace chimera::library::grammar {
   using NumbericLimits = std::numeric_limits<std::uint16_t>;
   constexpr static auto bufferSize = NumbericLimits::max();
   Input::Input(std::istream &input, const char *source)
-      : InputBase{input, bufferSize, source} {}
-  [[nodiscard]] auto Input::dedent() -> bool {
+      : BasicInput{input, bufferSize, source} {}
+  MemoryInput::MemoryInput(std::string_view input, const char *source)
+      : BasicInput{input.data(), input.size(), source} {}
+  template <typename Base>
+  [[nodiscard]] auto BasicInput<Base>::dedent() -> bool {
     using namespace std::literals;
     if (!is_dedent()) {
       return false;
@@ -34,51 +40,50 @@ namespace chimera::library::grammar {
     if (indentStack.empty()) {
       indentType = '\0';
     }
-    if (empty()) {
+    if (this->empty()) {
       return true;
     }
-    if ((indentStack.empty() && column() > 1) ||
-        (!indentStack.empty() && column() > indentStack.top())) {
+    if ((indentStack.empty() && this->column() > 1) ||
+        (!indentStack.empty() && this->column() > indentStack.top())) {
       throw tao::pegtl::parse_error("bad dedent"s, *this);
     }
     return true;
   }
-  [[nodiscard]] auto Input::indent() -> bool {
-    const auto col = column();
+  template <typename Base>
+  [[nodiscard]] auto BasicInput<Base>::indent() -> bool {
+    const auto col = this->column();
     if ((indentStack.empty() || indentStack.top() < col) && validate()) {
       indentStack.push(col);
       return true;
     }
     return false;
   }
-  [[nodiscard]] auto Input::is_dedent() -> bool {
+  template <typename Base>
+  [[nodiscard]] auto BasicInput<Base>::is_dedent() -> bool {
     if (indentStack.empty()) {
       return false;
     }
-    return empty() || column() < indentStack.top();
+    return this->empty() || this->column() < indentStack.top();
   }
-  [[nodiscard]] auto Input::is_newline() const -> bool {
-    const auto col = column();
+  template <typename Base>
+  [[nodiscard]] auto BasicInput<Base>::is_newline() const -> bool {
+    const auto col = this->column();
     if (indentStack.empty()) {
       return 1 == col;
     }
     return indentStack.top() == col;
   }
-  [[nodiscard]] auto Input::validate() -> bool {
-    const auto *begin = current();
-    auto col = column();
-    if (col == 0) {
+  template <typename Base>
+  [[nodiscard]] auto BasicInput<Base>::validate() -> bool {
+    // the indent is everything before the cursor on this line, a mapped
+    // source has nothing readable before its first byte
+    auto col = this->column();
+    if (col <= 1) {
       return false;
     }
-    std::advance(begin, -col);
-    while (*begin == '\n' || *begin == '\r') {
-      col -= 1;
-      if (col == 0) {
-        return false;
-      }
-      std::advance(begin, 1);
-    }
-    const std::string_view line(begin, col);
+    const auto *begin = this->current();
+    std::advance(begin, 1 - static_cast<std::ptrdiff_t>(col));
+    const std::string_view line(begin, col - 1);
     if (indentType == '\0') {
       if (validateBasic(line, *begin)) {
         indentType = *begin;
@@ -88,4 +93,6 @@ namespace chimera::library::grammar {
     }
     return validateBasic(line, indentType);
   }
+  template struct BasicInput<InputBase>;
+  template struct BasicInput<MemoryInputBase>;
 } // namespace chimera::library::grammar
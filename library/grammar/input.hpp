@@ -5,16 +5,18 @@
 
 #include <exception>                   // for throw_with_nested
 #include <tao/pegtl/istream_input.hpp> // for istream_input
+#include <tao/pegtl/memory_input.hpp>  // for memory_input
 
 #include <cstdint>
 #include <iosfwd>
 #include <stack>
+#include <string_view>
 #include <variant>
 
 namespace chimera::library::grammar {
-  using InputBase = tao::pegtl::istream_input<>;
-  struct Input : InputBase {
-    Input(std::istream &input, const char *source);
+  template <typename Base>
+  struct BasicInput : Base {
+    using Base::Base;
     [[nodiscard]] auto dedent() -> bool;
     [[nodiscard]] auto indent() -> bool;
     [[nodiscard]] auto is_newline() const -> bool;
@@ -25,4 +27,14 @@ namespace chimera::library::grammar {
     char indentType = '\0';
     std::stack<std::uintmax_t> indentStack{};
   };
+  using InputBase = tao::pegtl::istream_input<>;
+  struct Input : BasicInput<InputBase> {
+    Input(std::istream &input, const char *source);
+  };
+  using MemoryInputBase = tao::pegtl::memory_input<>;
+  //! parses a buffer in place, the caller keeps it alive for the parse and
+  //! for as long as anything keeps views into it
+  struct MemoryInput : BasicInput<MemoryInputBase> {
+    MemoryInput(std::string_view input, const char *source);
+  };
 } // namespace chimera::library::grammar
@@ -0,0 +1,96 @@
+//! parse definitions for unicode identifier characters.
+//! decodes one code point and looks its class up in a generated table
+
+#pragma once
+
+#include "grammar/rules.hpp"
+#include "grammar/utf8_id_table.hpp"
+
+#include <algorithm> // for min
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint32_t
+
+namespace chimera::library::grammar {
+  namespace utf8_id {
+    enum class Property : std::uint32_t { XID_START, XID_CONTINUE };
+    [[nodiscard]] constexpr auto lookup(char32_t code,
+                                        Property property) noexcept -> bool {
+      if (code >= limit) {
+        return false;
+      }
+      auto base =
+          (blocks.at(code / block) * 2U + static_cast<std::uint32_t>(property)) *
+          words;
+      auto offset = code % block;
+      return ((bits.at(base + offset / 64U) >> (offset % 64U)) & 1U) != 0;
+    }
+    struct Decoded {
+      char32_t code;
+      //! zero when the bytes are not well formed UTF-8
+      std::size_t size;
+    };
+    [[nodiscard]] constexpr auto decode(const char *data,
+                                        std::size_t size) noexcept
+        -> Decoded {
+      // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto lead = static_cast<unsigned char>(data[0]);
+      if (lead < 0x80U) {
+        return {lead, 1};
+      }
+      std::size_t length = 0;
+      char32_t code = 0;
+      char32_t minimum = 0;
+      if ((lead & 0xE0U) == 0xC0U) {
+        length = 2;
+        code = lead & 0x1FU;
+        minimum = 0x80;
+      } else if ((lead & 0xF0U) == 0xE0U) {
+        length = 3;
+        code = lead & 0x0FU;
+        minimum = 0x800;
+      } else if ((lead & 0xF8U) == 0xF0U) {
+        length = 4;
+        code = lead & 0x07U;
+        minimum = 0x10000;
+      } else {
+        return {0, 0};
+      }
+      if (size < length) {
+        return {0, 0};
+      }
+      for (std::size_t index = 1; index < length; ++index) {
+        const auto next = static_cast<unsigned char>(data[index]);
+        if ((next & 0xC0U) != 0x80U) {
+          return {0, 0};
+        }
+        code = (code << 6U) | (next & 0x3FU);
+      }
+      // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if (code < minimum || code > 0x10FFFF ||
+          (code >= 0xD800 && code <= 0xDFFF)) {
+        return {0, 0};
+      }
+      return {code, length};
+    }
+    //! one code point with property, in a single table lookup
+    template <Property Type>
+    struct Rule : any {
+      template <typename Input, typename... Args>
+      static auto match(Input &&input, Args &&.../*args*/) -> bool {
+        const auto available = input.size(4);
+        if (available == 0) {
+          return false;
+        }
+        auto [code, size] = decode(input.current(),
+                                   std::min(available, std::size_t{4}));
+        if (size == 0 || !lookup(code, Type)) {
+          return false;
+        }
+        input.bump_in_this_line(size);
+        return true;
+      }
+    };
+  } // namespace utf8_id
+  struct Utf8IdStart : utf8_id::Rule<utf8_id::Property::XID_START> {};
+  struct Utf8IdContinue : utf8_id::Rule<utf8_id::Property::XID_CONTINUE> {};
+} // namespace chimera::library::grammar
@@ -0,0 +1,642 @@
+//! generated file see tools/generate_utf8_id_table.py
+//! from Unicode 15.1.0
+
+#pragma once
+
+#include <array>   // for array
+#include <cstdint> // for uint8_t, uint64_t
+
+namespace chimera::library::grammar::utf8_id {
+  //! block size and words per class in each block of bits
+  inline constexpr std::uint32_t block = 256;
+  inline constexpr std::uint32_t words = 4;
+#ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+  inline constexpr std::uint32_t limit = 0x100;
+  //! bitmap block for each run of 256 code points
+  inline constexpr std::array<std::uint8_t, 1> blocks{{
+      0,
+  }};
+  //! 4 words of XID_Start then 4 of XID_Continue per block
+  inline constexpr std::array<std::uint64_t, 8> bits{{
+      0x0000000000000000U, 0x07fffffe87fffffeU, 0x0420040000000000U,
+      0xff7fffffff7fffffU, 0x03ff000000000000U, 0x07fffffe87fffffeU,
+      0x04a0040000000000U, 0xff7fffffff7fffffU,
+  }};
+#else
+  inline constexpr std::uint32_t limit = 0x110000;
+  //! bitmap block for each run of 256 code points
+  inline constexpr std::array<std::uint8_t, 4352> blocks{{
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      16, 1, 17, 18, 19, 1, 20, 21, 22, 23, 24, 25, 26, 27, 1, 28,
+      29, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 33, 31, 31,
+      34, 35, 31, 31, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 36, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 37, 1, 38, 39, 40, 41, 42, 43, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 44, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 1, 45, 46, 47, 48, 49, 50,
+      51, 52, 53, 54, 55, 56, 1, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+      66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 31, 77, 78, 79, 80,
+      1, 1, 1, 81, 82, 83, 31, 31, 31, 31, 31, 31, 31, 31, 31, 84,
+      1, 1, 1, 1, 85, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 1, 1, 86, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 87, 88, 31, 31, 89, 90,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 91, 1, 1, 1, 1, 92, 93, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 94,
+      1, 95, 96, 31, 31, 31, 31, 31, 31, 31, 31, 31, 97, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 98,
+      31, 99, 100, 31, 101, 102, 103, 104, 31, 31, 105, 31, 31, 31, 31, 106,
+      107, 108, 109, 31, 110, 31, 31, 111, 112, 113, 31, 31, 31, 31, 114, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 115, 31, 31, 31, 31,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 116, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 117, 118, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 119, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 120, 1, 1, 121, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 122, 31, 31, 31, 31, 31,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 123, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 124, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 125, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  }};
+  //! 4 words of XID_Start then 4 of XID_Continue per block
+  inline constexpr std::array<std::uint64_t, 1008> bits{{
+      0x0000000000000000U, 0x07fffffe87fffffeU, 0x0420040000000000U,
+      0xff7fffffff7fffffU, 0x03ff000000000000U, 0x07fffffe87fffffeU,
+      0x04a0040000000000U, 0xff7fffffff7fffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x0000501f0003ffc3U, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x0000501f0003ffc3U,
+      0x0000000000000000U, 0xb8df000000000000U, 0xfffffffbffffd740U,
+      0xffbfffffffffffffU, 0xffffffffffffffffU, 0xb8dfffffffffffffU,
+      0xfffffffbffffd7c0U, 0xffbfffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xfffffffffffffc03U, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xfffffffffffffcfbU,
+      0xffffffffffffffffU, 0xfffeffffffffffffU, 0xffffffff027fffffU,
+      0x00000000000001ffU, 0x000787ffffff0000U, 0xfffeffffffffffffU,
+      0xffffffff027fffffU, 0xbffffffffffe01ffU, 0x000787ffffff00b6U,
+      0xffffffff00000000U, 0xfffec000000007ffU, 0xffffffffffffffffU,
+      0x9c00c060002fffffU, 0xffffffff07ff0000U, 0xffffc3ffffffffffU,
+      0xffffffffffffffffU, 0x9ffffdff9fefffffU, 0x0000fffffffd0000U,
+      0xffffffffffffe000U, 0x0002003fffffffffU, 0x043007fffffffc00U,
+      0xffffffffffff0000U, 0xffffffffffffe7ffU, 0x0003ffffffffffffU,
+      0x243fffffffffffffU, 0x00000110043fffffU, 0xffff07ff01ffffffU,
+      0xffffffff00007effU, 0x00000000000003ffU, 0x00003fffffffffffU,
+      0xffff07ff0fffffffU, 0xffffffffff007effU, 0xfffffffbffffffffU,
+      0x23fffffffffffff0U, 0xfffe0003ff010000U, 0x23c5fdfffff99fe1U,
+      0x10030003b0004000U, 0xffffffffffffffffU, 0xfffeffcfffffffffU,
+      0xf3c5fdfffff99fefU, 0x5003ffcfb080799fU, 0x036dfdfffff987e0U,
+      0x001c00005e000000U, 0x23edfdfffffbbfe0U, 0x0200000300010000U,
+      0xd36dfdfffff987eeU, 0x003fffc05e023987U, 0xf3edfdfffffbbfeeU,
+      0xfe00ffcf00013bbfU, 0x23edfdfffff99fe0U, 0x00020003b0000000U,
+      0x03ffc718d63dc7e8U, 0x0000000000010000U, 0xf3edfdfffff99feeU,
+      0x0002ffcfb0e0399fU, 0xc3ffc718d63dc7ecU, 0x0000ffc000813dc7U,
+      0x23fffdfffffddfe0U, 0x0000000327000000U, 0x23effdfffffddfe1U,
+      0x0006000360000000U, 0xf3fffdfffffddfffU, 0x0000ffcf27603ddfU,
+      0xf3effdfffffddfefU, 0x000effcf60603ddfU, 0x27fffffffffddff0U,
+      0xfc00000380704000U, 0x2ffbfffffc7fffe0U, 0x000000000000007fU,
+      0xfffffffffffddfffU, 0xfc00ffcf80f07ddfU, 0x2ffbfffffc7fffeeU,
+      0x000cffc0ff5f847fU, 0x0005fffffffffffeU, 0x000000000000007fU,
+      0x2005ffaffffff7d6U, 0x00000000f000005fU, 0x07fffffffffffffeU,
+      0x0000000003ff7fffU, 0x3fffffaffffff7d6U, 0x00000000f3ff7f5fU,
+      0x0000000000000001U, 0x00001ffffffffeffU, 0x0000000000001f00U,
+      0x0000000000000000U, 0xc2a003ff03000001U, 0xfffe1ffffffffeffU,
+      0x1ffffffffeffffdfU, 0x0000000000000040U, 0x800007ffffffffffU,
+      0xffe1c0623c3f0000U, 0xffffffff00004003U, 0xf7ffffffffff20bfU,
+      0xffffffffffffffffU, 0xffffffffffff03ffU, 0xffffffff3fffffffU,
+      0xf7ffffffffff20bfU, 0xffffffffffffffffU, 0xffffffff3d7f3dffU,
+      0x7f3dffffffff3dffU, 0xffffffffff7fff3dU, 0xffffffffffffffffU,
+      0xffffffff3d7f3dffU, 0x7f3dffffffff3dffU, 0xffffffffff7fff3dU,
+      0xffffffffff3dffffU, 0x0000000007ffffffU, 0xffffffff0000ffffU,
+      0x3f3fffffffffffffU, 0xffffffffff3dffffU, 0x0003fe00e7ffffffU,
+      0xffffffff0000ffffU, 0x3f3fffffffffffffU, 0xfffffffffffffffeU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xfffffffffffffffeU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffff9fffffffffffU,
+      0xffffffff07fffffeU, 0x01ffc7ffffffffffU, 0xffffffffffffffffU,
+      0xffff9fffffffffffU, 0xffffffff07fffffeU, 0x01ffc7ffffffffffU,
+      0x0003ffff8003ffffU, 0x0001dfff0003ffffU, 0x000fffffffffffffU,
+      0x0000000010800000U, 0x001fffff803fffffU, 0x000ddfff000fffffU,
+      0xffffffffffffffffU, 0x000003ff308fffffU, 0xffffffff00000000U,
+      0x01ffffffffffffffU, 0xffff05ffffffffffU, 0x003fffffffffffffU,
+      0xffffffff03ffb800U, 0x01ffffffffffffffU, 0xffff07ffffffffffU,
+      0x003fffffffffffffU, 0x000000007fffffffU, 0x001f3fffffff0000U,
+      0xffff0fffffffffffU, 0x00000000000003ffU, 0x0fff0fff7fffffffU,
+      0x001f3fffffffffc0U, 0xffff0fffffffffffU, 0x0000000007ff03ffU,
+      0xffffffff007fffffU, 0x00000000001fffffU, 0x0000008000000000U,
+      0x0000000000000000U, 0xffffffff0fffffffU, 0x9fffffff7fffffffU,
+      0xbfff008003ff03ffU, 0x0000000000007fffU, 0x000fffffffffffe0U,
+      0x0000000000001fe0U, 0xfc00c001fffffff8U, 0x0000003fffffffffU,
+      0xffffffffffffffffU, 0x000ff80003ff1fffU, 0xffffffffffffffffU,
+      0x000fffffffffffffU, 0x0000000fffffffffU, 0x3ffffffffc00e000U,
+      0xe7ffffffffff01ffU, 0x046fde0000000000U, 0x00ffffffffffffffU,
+      0x3fffffffffffe3ffU, 0xe7ffffffffff01ffU, 0x07fffffffff70000U,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0x0000000000000000U, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffff3f3fffffU,
+      0x3fffffffaaff3f3fU, 0x5fdfffffffffffffU, 0x1fdc1fff0fcf1fdcU,
+      0xffffffff3f3fffffU, 0x3fffffffaaff3f3fU, 0x5fdfffffffffffffU,
+      0x1fdc1fff0fcf1fdcU, 0x0000000000000000U, 0x8002000000000000U,
+      0x000000001fff0000U, 0x0000000000000000U, 0x8000000000003000U,
+      0x8002000000100001U, 0x000000001fff0000U, 0x0001ffe21fff0000U,
+      0xf3fffd503f2ffc84U, 0xffffffff000043e0U, 0x00000000000001ffU,
+      0x0000000000000000U, 0xf3fffd503f2ffc84U, 0xffffffff000043e0U,
+      0x00000000000001ffU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x000c781fffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x000ff81fffffffffU,
+      0xffff20bfffffffffU, 0x000080ffffffffffU, 0x7f7f7f7f007fffffU,
+      0x000000007f7f7f7fU, 0xffff20bfffffffffU, 0x800080ffffffffffU,
+      0x7f7f7f7f007fffffU, 0xffffffff7f7f7f7fU, 0x1f3e03fe000000e0U,
+      0xfffffffffffffffeU, 0xfffffffee07fffffU, 0xf7ffffffffffffffU,
+      0x1f3efffe000000e0U, 0xfffffffffffffffeU, 0xfffffffee67fffffU,
+      0xffffffffffffffffU, 0xfffeffffffffffe0U, 0xffffffffffffffffU,
+      0xffffffff00007fffU, 0xffff000000000000U, 0xfffeffffffffffe0U,
+      0xffffffffffffffffU, 0xffffffff00007fffU, 0xffff000000000000U,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0x0000000000000000U, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x0000000000000000U, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x0000000000001fffU, 0x3fffffffffff0000U,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x0000000000001fffU,
+      0x3fffffffffff0000U, 0x00000c00ffff1fffU, 0x80007fffffffffffU,
+      0xffffffff3fffffffU, 0x0000ffffffffffffU, 0x00000fffffff1fffU,
+      0xbff0ffffffffffffU, 0xffffffffffffffffU, 0x0003ffffffffffffU,
+      0xfffffffcff800000U, 0xffffffffffffffffU, 0xfffffffffffff9ffU,
+      0xfffc000003eb07ffU, 0xfffffffcff800000U, 0xffffffffffffffffU,
+      0xfffffffffffff9ffU, 0xfffc000003eb07ffU, 0x00000007fffff7bbU,
+      0x000fffffffffffffU, 0x000ffffffffffffcU, 0x68fc000000000000U,
+      0x000010ffffffffffU, 0x000fffffffffffffU, 0xffffffffffffffffU,
+      0xe8ffffff03ff003fU, 0xffff003ffffffc00U, 0x1fffffff0000007fU,
+      0x0007fffffffffff0U, 0x7c00ffdf00008000U, 0xffff3fffffffffffU,
+      0x1fffffff000fffffU, 0xffffffffffffffffU, 0x7fffffff03ff8001U,
+      0x000001ffffffffffU, 0xc47fffff00000ff7U, 0x3e62ffffffffffffU,
+      0x001c07ff38000005U, 0x007fffffffffffffU, 0xfc7fffff03ff3fffU,
+      0xffffffffffffffffU, 0x007cffff38000007U, 0xffff7f7f007e7e7eU,
+      0xffff03fff7ffffffU, 0xffffffffffffffffU, 0x00000007ffffffffU,
+      0xffff7f7f007e7e7eU, 0xffff03fff7ffffffU, 0xffffffffffffffffU,
+      0x03ff37ffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffff000fffffffffU, 0x0ffffffffffff87fU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffff000fffffffffU, 0x0ffffffffffff87fU,
+      0xffffffffffffffffU, 0xffff3fffffffffffU, 0xffffffffffffffffU,
+      0x0000000003ffffffU, 0xffffffffffffffffU, 0xffff3fffffffffffU,
+      0xffffffffffffffffU, 0x0000000003ffffffU, 0x5f7ffdffa0f8007fU,
+      0xffffffffffffffdbU, 0x0003ffffffffffffU, 0xfffffffffff80000U,
+      0x5f7ffdffe0f8007fU, 0xffffffffffffffdbU, 0x0003ffffffffffffU,
+      0xfffffffffff80000U, 0xffffffffffffffffU, 0xfffffff03fffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xfffffff03fffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0x3fffffffffffffffU, 0xffffffffffff0000U, 0xfffffffffffcffffU,
+      0x03ff0000000000ffU, 0x3fffffffffffffffU, 0xffffffffffff0000U,
+      0xfffffffffffcffffU, 0x03ff0000000000ffU, 0x0000000000000000U,
+      0xaa8a000000000000U, 0xffffffffffffffffU, 0x1fffffffffffffffU,
+      0x0018ffff0000ffffU, 0xaa8a00000000e000U, 0xffffffffffffffffU,
+      0x1fffffffffffffffU, 0x07fffffe00000000U, 0xffffffc007fffffeU,
+      0x7fffffff3fffffffU, 0x000000001cfcfcfcU, 0x87fffffe03ff0000U,
+      0xffffffe007fffffeU, 0x7fffffffffffffffU, 0x000000001cfcfcfcU,
+      0xb7ffff7fffffefffU, 0x000000003fff3fffU, 0xffffffffffffffffU,
+      0x07ffffffffffffffU, 0xb7ffff7fffffefffU, 0x000000003fff3fffU,
+      0xffffffffffffffffU, 0x07ffffffffffffffU, 0x0000000000000000U,
+      0x001fffffffffffffU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x001fffffffffffffU, 0x0000000000000000U,
+      0x2000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0xffffffff1fffffffU, 0x000000000001ffffU, 0x0000000000000000U,
+      0x0000000000000000U, 0xffffffff1fffffffU, 0x000000010001ffffU,
+      0xffffe000ffffffffU, 0x003fffffffff07ffU, 0xffffffff3fffffffU,
+      0x00000000003eff0fU, 0xffffe000ffffffffU, 0x07ffffffffff07ffU,
+      0xffffffff3fffffffU, 0x00000000003eff0fU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffff00003fffffffU, 0x0fffffffff0fffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffff03ff3fffffffU,
+      0x0fffffffff0fffffU, 0xffff00ffffffffffU, 0xf7ff000fffffffffU,
+      0x1bfbfffbffb7f7ffU, 0x0000000000000000U, 0xffff00ffffffffffU,
+      0xf7ff000fffffffffU, 0x1bfbfffbffb7f7ffU, 0x0000000000000000U,
+      0x007fffffffffffffU, 0x000000ff003fffffU, 0x07fdffffffffffbfU,
+      0x0000000000000000U, 0x007fffffffffffffU, 0x000000ff003fffffU,
+      0x07fdffffffffffbfU, 0x0000000000000000U, 0x91bffffffffffd3fU,
+      0x007fffff003fffffU, 0x000000007fffffffU, 0x0037ffff00000000U,
+      0x91bffffffffffd3fU, 0x007fffff003fffffU, 0x000000007fffffffU,
+      0x0037ffff00000000U, 0x03ffffff003fffffU, 0x0000000000000000U,
+      0xc0ffffffffffffffU, 0x0000000000000000U, 0x03ffffff003fffffU,
+      0x0000000000000000U, 0xc0ffffffffffffffU, 0x0000000000000000U,
+      0x003ffffffeef0001U, 0x1fffffff00000000U, 0x000000001fffffffU,
+      0x0000001ffffffeffU, 0x873ffffffeeff06fU, 0x1fffffff00000000U,
+      0x000000001fffffffU, 0x0000007ffffffeffU, 0x003fffffffffffffU,
+      0x0007ffff003fffffU, 0x000000000003ffffU, 0x0000000000000000U,
+      0x003fffffffffffffU, 0x0007ffff003fffffU, 0x000000000003ffffU,
+      0x0000000000000000U, 0xffffffffffffffffU, 0x00000000000001ffU,
+      0x0007ffffffffffffU, 0x0007ffffffffffffU, 0xffffffffffffffffU,
+      0x00000000000001ffU, 0x0007ffffffffffffU, 0x0007ffffffffffffU,
+      0x0000000fffffffffU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x03ff00ffffffffffU, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x000303ffffffffffU, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x00031bffffffffffU,
+      0xe000000000000000U, 0xffff00801fffffffU, 0xffff00000000003fU,
+      0xffff000000000003U, 0x007fffff0000001fU, 0xffff00801fffffffU,
+      0xffff00000001ffffU, 0xffff00000000003fU, 0x007fffff0000001fU,
+      0x00fffffffffffff8U, 0x0026000000000000U, 0x0000fffffffffff8U,
+      0x000001ffffff0000U, 0xffffffffffffffffU, 0x803fffc00000007fU,
+      0x07ffffffffffffffU, 0x03ff01ffffff0004U, 0x0000007ffffffff8U,
+      0x0047ffffffff0090U, 0x0007fffffffffff8U, 0x000000001400001eU,
+      0xffdfffffffffffffU, 0x004fffffffff00f0U, 0xffffffffffffffffU,
+      0x0000000017ffde1fU, 0x80000ffffffbffffU, 0x0000000000000001U,
+      0xffff01ffbfffbd7fU, 0x000000007fffffffU, 0xc0fffffffffbffffU,
+      0x0000000000000003U, 0xffff01ffbfffbd7fU, 0x03ff07ffffffffffU,
+      0x23edfdfffff99fe0U, 0x00000003e0010000U, 0x0000000000000000U,
+      0x0000000000000000U, 0xfbedfdfffff99fefU, 0x001f1fcfe081399fU,
+      0x0000000000000000U, 0x0000000000000000U, 0x001fffffffffffffU,
+      0x0000000380000780U, 0x0000ffffffffffffU, 0x00000000000000b0U,
+      0xffffffffffffffffU, 0x00000003c3ff07ffU, 0xffffffffffffffffU,
+      0x0000000003ff00bfU, 0x0000000000000000U, 0x0000000000000000U,
+      0x00007fffffffffffU, 0x000000000f000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0xff3fffffffffffffU, 0x000000003f000001U,
+      0x0000ffffffffffffU, 0x0000000000000010U, 0x010007ffffffffffU,
+      0x0000000000000000U, 0xffffffffffffffffU, 0x0000000003ff0011U,
+      0x01ffffffffffffffU, 0x00000000000003ffU, 0x0000000007ffffffU,
+      0x000000000000007fU, 0x0000000000000000U, 0x0000000000000000U,
+      0x03ff0fffe7ffffffU, 0x000000000000007fU, 0x0000000000000000U,
+      0x0000000000000000U, 0x00000fffffffffffU, 0x0000000000000000U,
+      0xffffffff00000000U, 0x80000000ffffffffU, 0x07ffffffffffffffU,
+      0x0000000000000000U, 0xffffffff00000000U, 0x800003ffffffffffU,
+      0x8000ffffff6ff27fU, 0x0000000000000002U, 0xfffffcff00000000U,
+      0x0000000a0001ffffU, 0xf9bfffffff6ff27fU, 0x0000000003ff000fU,
+      0xfffffcff00000000U, 0x0000001bfcffffffU, 0x0407fffffffff801U,
+      0xfffffffff0010000U, 0xffff0000200003ffU, 0x01ffffffffffffffU,
+      0x7fffffffffffffffU, 0xffffffffffff0080U, 0xffff000023ffffffU,
+      0x01ffffffffffffffU, 0x00007ffffffffdffU, 0xfffc000000000001U,
+      0x000000000000ffffU, 0x0000000000000000U, 0xff7ffffffffffdffU,
+      0xfffc000003ff0001U, 0x007ffefffffcffffU, 0x0000000000000000U,
+      0x0001fffffffffb7fU, 0xfffffdbf00000040U, 0x00000000010003ffU,
+      0x0000000000000000U, 0xb47ffffffffffb7fU, 0xfffffdbf03ff00ffU,
+      0x000003ff01fb7fffU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0007ffff00000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x007fffff00000000U, 0x000ffffffffdfff4U, 0x0000000000000000U,
+      0x0001000000000000U, 0x0000000000000000U, 0xc7fffffffffdffffU,
+      0x0000000003ff0007U, 0x0001000000000000U, 0x0000000000000000U,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x0000000003ffffffU,
+      0x0000000000000000U, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0x0000000003ffffffU, 0x0000000000000000U, 0xffffffffffffffffU,
+      0x00007fffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x00007fffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x000000000000000fU,
+      0x0000000000000000U, 0x0000000000000000U, 0xffffffffffffffffU,
+      0x000000000000000fU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0xffffffffffff0000U,
+      0x0001ffffffffffffU, 0x0000000000000000U, 0x0000000000000000U,
+      0xffffffffffff0000U, 0x0001ffffffffffffU, 0x0000ffffffffffffU,
+      0x000000000000007eU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000ffffffffffffU, 0x00000000003fffffU, 0x0000000000000000U,
+      0x0000000000000000U, 0xffffffffffffffffU, 0x000000000000007fU,
+      0x0000000000000000U, 0x0000000000000000U, 0xffffffffffffffffU,
+      0x000000000000007fU, 0x0000000000000000U, 0x0000000000000000U,
+      0x01ffffffffffffffU, 0xffff00007fffffffU, 0x7fffffffffffffffU,
+      0x00003fffffff0000U, 0x01ffffffffffffffU, 0xffff03ff7fffffffU,
+      0x7fffffffffffffffU, 0x001f3fffffff03ffU, 0x0000ffffffffffffU,
+      0xe0fffff80000000fU, 0x000000000000ffffU, 0x0000000000000000U,
+      0x007fffffffffffffU, 0xe0fffff803ff000fU, 0x000000000000ffffU,
+      0x0000000000000000U, 0x0000000000000000U, 0xffffffffffffffffU,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0xffffffffffffffffU, 0x0000000000000000U, 0x0000000000000000U,
+      0xffffffffffffffffU, 0x00000000000107ffU, 0x00000000fff80000U,
+      0x0000000b00000000U, 0xffffffffffffffffU, 0xffffffffffff87ffU,
+      0x00000000ffff80ffU, 0x0003001b00000000U, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x00ffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0x00ffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x00000000003fffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x00000000003fffffU,
+      0x00000000000001ffU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x00000000000001ffU, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x6fef000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x6fef000000000000U, 0x00040007ffffffffU, 0xffff00f000270000U,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x00040007ffffffffU,
+      0xffff00f000270000U, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0x0fffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x0fffffffffffffffU, 0xffffffffffffffffU,
+      0x1fff07ffffffffffU, 0x0000000003ff01ffU, 0x0000000000000000U,
+      0xffffffffffffffffU, 0x1fff07ffffffffffU, 0x0000000063ff01ffU,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0xffff3fffffffffffU,
+      0x000000000000007fU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0xf807e3e000000000U,
+      0x00003c0000000fe7U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x000000000000001cU, 0x0000000000000000U,
+      0x0000000000000000U, 0xffffffffffffffffU, 0xffffffffffdfffffU,
+      0xebffde64dfffffffU, 0xffffffffffffffefU, 0xffffffffffffffffU,
+      0xffffffffffdfffffU, 0xebffde64dfffffffU, 0xffffffffffffffefU,
+      0x7bffffffdfdfe7bfU, 0xfffffffffffdfc5fU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x7bffffffdfdfe7bfU, 0xfffffffffffdfc5fU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffff3fffffffffU, 0xf7fffffff7fffffdU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffff3fffffffffU,
+      0xf7fffffff7fffffdU, 0xffdfffffffdfffffU, 0xffff7fffffff7fffU,
+      0xfffffdfffffffdffU, 0x0000000000000ff7U, 0xffdfffffffdfffffU,
+      0xffff7fffffff7fffU, 0xfffffdfffffffdffU, 0xffffffffffffcff7U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0xf87fffffffffffffU, 0x00201fffffffffffU,
+      0x0000fffef8000010U, 0x0000000000000000U, 0x000007e07fffffffU,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x000007e07fffffffU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0xffff000000000000U, 0x00003fffffffffffU,
+      0x0000000000000000U, 0x0000000000000000U, 0xffff07dbf9ffff7fU,
+      0x00003fffffffffffU, 0x0000000000008000U, 0x0000000000000000U,
+      0x3f801fffffffffffU, 0x0000000000004000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x3fff1fffffffffffU, 0x00000000000043ffU,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x00003fffffff0000U, 0x00000fffffffffffU,
+      0x0000000000000000U, 0x0000000000000000U, 0x00007fffffff0000U,
+      0x03ffffffffffffffU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x00000fffffff0000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x03ffffffffff0000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x7fff6f7f00000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x7fff6f7f00000000U, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x000000000000001fU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0x00000000007f001fU, 0xffffffffffffffffU, 0x000000000000080fU,
+      0x0000000000000000U, 0x0000000000000000U, 0xffffffffffffffffU,
+      0x0000000003ff0fffU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0af7fe96ffffffefU, 0x5ef7f796aa96ea84U, 0x0ffffbee0ffffbffU,
+      0x0000000000000000U, 0x0af7fe96ffffffefU, 0x5ef7f796aa96ea84U,
+      0x0ffffbee0ffffbffU, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x03ff000000000000U, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x00000000ffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x00000000ffffffffU,
+      0x03ffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x03ffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffff3fffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffff3fffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffff0003ffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffff0003ffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffff0001ffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffff0001ffffffffU, 0xffffffffffffffffU,
+      0x000000003fffffffU, 0x0000000000000000U, 0x0000000000000000U,
+      0xffffffffffffffffU, 0x000000003fffffffU, 0x0000000000000000U,
+      0x0000000000000000U, 0x000000003fffffffU, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0x000000003fffffffU,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0xffffffffffffffffU, 0xffffffffffff07ffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffff07ffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0x0000ffffffffffffU, 0x0000000000000000U,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x0000ffffffffffffU,
+      0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+      0x0000000000000000U, 0x0000000000000000U, 0xffffffffffffffffU,
+      0xffffffffffffffffU, 0xffffffffffffffffU, 0x0000ffffffffffffU,
+  }};
+#endif
+} // namespace chimera::library::grammar::utf8_id
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "grammar/ascii.hpp"
 #include "grammar/flags.hpp"
 #include "grammar/rules.hpp"
 #include "grammar/utf8_space.hpp"
@@ -20,13 +21,19 @@ namespace chimera::library::grammar {
   using Utf8NonLineBreak = minus<Utf8Space, one<'\n', '\r'>>;
   using Eol = sor<String<'\r', '\n'>, one<'\r', '\n'>>;
   using Eolf = sor<eof, Eol>;
+  //! plain ASCII runs are skipped in bulk before the unicode rules see
+  //! whatever byte stopped them
   template <flags::Flag Option>
   using Space = star<
-      sor<seq<one<'\\'>, Eol>, seq<one<'#'>, star<not_at<Eolf>, any>>,
+      sor<ascii::Plus<ascii::Blank<flags::get<Option, flags::IMPLICIT>>>,
+          seq<one<'\\'>, Eol>,
+          seq<one<'#'>, ascii::Star<ascii::CommentChar>,
+              star<not_at<Eolf>, any>>,
           std::conditional_t<flags::get<Option, flags::IMPLICIT>, Utf8Space,
                              minus<Utf8Space, one<'\r', '\n'>>>>,
       std::conditional_t<flags::get<Option, flags::DISCARD>, discard, success>>;
-  using BlankLines = seq<plus<Space<0>, Eol>, star<Utf8NonLineBreak>>;
+  using BlankLines = seq<plus<Space<0>, Eol>, ascii::Star<ascii::Blank<false>>,
+                         star<Utf8NonLineBreak>>;
   struct Indent : not_at<Utf8NonLineBreak> {
     template <typename Input, typename... Args>
     static auto match(Input &&input, Args &&.../*args*/) -> bool {
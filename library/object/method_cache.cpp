@@ -0,0 +1,73 @@
+//! class attribute lookups reused until a class they walked changes
+
+#include "object/method_cache.hpp"
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t, uintptr_t
+#include <utility> // for move
+#include <vector>  // for vector
+
+namespace chimera::library::object {
+  //! direct mapped, a colliding lookup replaces the entry
+  static constexpr std::size_t methodEntries = 1024;
+  struct MethodGuard {
+    //! keeps the address from being reused while the entry refers to it
+    internal::WeakObject type;
+    std::uint32_t version;
+  };
+  struct MethodEntry {
+    std::uint32_t name = 0;
+    //! type itself first, then each class of its __mro__ up to the one
+    //! that had name
+    std::vector<MethodGuard> guards{};
+    std::optional<Object> method{};
+  };
+  static auto method_entry(const Object &type, const Symbol &name)
+      -> MethodEntry & {
+    static thread_local std::vector<MethodEntry> entries(methodEntries);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto address = reinterpret_cast<std::uintptr_t>(type.address());
+    auto hash = (address >> 4U) ^ (std::uintptr_t{name.id()} * 0x9E3779B9U);
+    return entries[hash % methodEntries];
+  }
+  static auto current(const MethodEntry &entry, const Object &type,
+                      const Symbol &name) noexcept -> bool {
+    if (entry.name != name.id() || entry.guards.empty() ||
+        entry.guards.front().type.address() != type.address()) {
+      return false;
+    }
+    // type is alive and unchanged before its __mro__ is trusted to keep the
+    // later classes alive
+    for (const auto &guard : entry.guards) {
+      if (guard.type.version() != guard.version) {
+        return false;
+      }
+    }
+    return true;
+  }
+  static void guard(MethodEntry &entry, const Object &type) {
+    entry.guards.push_back({.type = type.weak(), .version = *type.version()});
+  }
+  [[nodiscard]] auto lookup_method(const Object &type, const Symbol &name)
+      -> std::optional<Object> {
+    auto &entry = method_entry(type, name);
+    if (current(entry, type, name)) {
+      return entry.method;
+    }
+    static const Symbol mroSymbol("__mro__");
+    MethodEntry walked{.name = name.id()};
+    guard(walked, type);
+    auto mro = type.get_attribute(mroSymbol);
+    if (const auto tuple = mro.get<Tuple>()) {
+      for (const auto &base : *tuple) {
+        guard(walked, base);
+        if (auto found = base.find_attribute(name)) {
+          walked.method = std::move(found);
+          break;
+        }
+      }
+    }
+    entry = std::move(walked);
+    return entry.method;
+  }
+} // namespace chimera::library::object
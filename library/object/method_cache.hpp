@@ -0,0 +1,16 @@
+//! class attribute lookups reused until a class they walked changes
+
+#pragma once
+
+#include "object/object.hpp" // for Object
+#include "object/symbol.hpp" // for Symbol
+
+#include <optional> // for optional
+
+namespace chimera::library::object {
+  //! name from the first class of the __mro__ of type that has it,
+  //! a hit is one probe of a per thread table and a version compare for
+  //! each class the original walk visited
+  [[nodiscard]] auto lookup_method(const Object &type, const Symbol &name)
+      -> std::optional<Object>;
+} // namespace chimera::library::object
@@ -2,20 +2,64 @@
 
 #include "number-rust.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
 // NOLINTBEGIN(cppcoreguidelines-macro-usage)
 
 namespace chimera::library::object::number {
-  Number::Number() : ref(r_create_number(0)) {}
-  Number::Number(std::uint64_t number) : ref(r_create_number(number)) {}
-  Number::Number(PythonNumber ref, bool /*unused*/) noexcept : ref(ref) {}
-  Number::Number(const Number &other) : ref(r_copy_number(other.ref)) {}
-  Number::Number(Number &&other) noexcept : ref(0) { swap(std::move(other)); }
+  using NumericLimits = std::numeric_limits<std::int64_t>;
+  constexpr static std::int64_t maxInline = NumericLimits::max() >> 1;
+  constexpr static std::int64_t minInline = NumericLimits::min() >> 1;
+  [[nodiscard]] constexpr static auto fits(std::int64_t value) -> bool {
+    return minInline <= value && value <= maxInline;
+  }
+  [[nodiscard]] constexpr static auto tag(std::int64_t value) -> PythonNumber {
+    return (static_cast<PythonNumber>(value) << 1U) | 1U;
+  }
+  //! owns one reference to a rust number for the length of a call
+  struct SharedHandle {
+    explicit SharedHandle(PythonNumber handle) noexcept : handle(handle) {}
+    SharedHandle(const SharedHandle &other) = delete;
+    SharedHandle(SharedHandle &&other) = delete;
+    ~SharedHandle() noexcept { r_delete_number(handle); }
+    auto operator=(const SharedHandle &other) -> SharedHandle & = delete;
+    auto operator=(SharedHandle &&other) -> SharedHandle & = delete;
+    PythonNumber handle;
+  };
+  Number::Number() : ref(tag(0)) {}
+  Number::Number(std::uint64_t number)
+      : ref(number <= static_cast<std::uint64_t>(maxInline)
+                ? tag(static_cast<std::int64_t>(number))
+                : r_create_number(number) << 1U) {}
+  Number::Number(PythonNumber handle, bool /*unused*/) noexcept
+      : ref(handle << 1U) {}
+  [[nodiscard]] auto Number::from_inline(std::int64_t value) noexcept
+      -> Number {
+    Number number;
+    number.ref = tag(value);
+    return number;
+  }
+  [[nodiscard]] auto Number::adopt(PythonNumber handle) noexcept -> Number {
+    if (auto value = r_small_int(handle); fits(value)) {
+      r_delete_number(handle);
+      return from_inline(value);
+    }
+    return {handle, false};
+  }
+  Number::Number(const Number &other)
+      : ref(other.is_inline() ? other.ref : other.share() << 1U) {}
+  Number::Number(Number &&other) noexcept : ref(tag(0)) {
+    swap(std::move(other));
+  }
   auto Number::operator=(const Number &other) -> Number & {
     if (this != &other) {
-      auto ptr = r_copy_number(other.ref);
-      using std::swap;
-      swap(ptr, ref);
-      r_delete_number(ptr);
+      Number copy(other);
+      swap(std::move(copy));
     }
     return *this;
   }
@@ -25,64 +69,332 @@ namespace chimera::library::object::number {
     }
     return *this;
   }
-  Number::~Number() { r_delete_number(ref); }
+  Number::~Number() {
+    if (!is_inline()) {
+      r_delete_number(handle());
+    }
+  }
   void Number::swap(Number &&other) noexcept {
     using std::swap;
     swap(ref, other.ref);
   }
-  Number::operator int64_t() const noexcept { return r_cast_int(ref); }
-  Number::operator uint64_t() const noexcept { return r_cast_unsigned(ref); }
-  Number::operator double() const noexcept { return r_cast_float(ref); }
-#define NUM_OP_MONO(op, name)                                                  \
-  auto Number::operator op() const -> Number { return {name(ref), false}; }
-#define NUM_OP(op, name)                                                       \
+  Number::operator int64_t() const noexcept {
+    if (is_inline()) {
+      return inline_value();
+    }
+    return r_cast_int(handle());
+  }
+  Number::operator uint64_t() const noexcept {
+    if (is_inline()) {
+      return inline_value() < 0 ? 0 : static_cast<uint64_t>(inline_value());
+    }
+    return r_cast_unsigned(handle());
+  }
+  Number::operator double() const noexcept {
+    if (is_inline()) {
+      return static_cast<double>(inline_value());
+    }
+    return r_cast_float(handle());
+  }
+  [[nodiscard]] auto Number::share() const -> PythonNumber {
+    if (!is_inline()) {
+      return r_copy_number(handle());
+    }
+    auto value = inline_value();
+    if (value >= 0) {
+      return r_create_number(static_cast<std::uint64_t>(value));
+    }
+    const SharedHandle positive(
+        r_create_number(static_cast<std::uint64_t>(-value)));
+    return r_neg(positive.handle);
+  }
+  [[nodiscard]] auto Number::promote(Binary function,
+                                     const Number &right) const -> Number {
+    const SharedHandle left(share());
+    const SharedHandle other(right.share());
+    return adopt(function(left.handle, other.handle));
+  }
+  [[nodiscard]] auto Number::promote(Unary function) const -> Number {
+    const SharedHandle left(share());
+    return adopt(function(left.handle));
+  }
+//! checked arithmetic on two inline values, promoting on overflow
+#define NUM_OP_CHECKED(op, name, builtin)                                      \
   auto Number::operator op(const Number & right) -> Number & {                 \
-    auto ptr = name(ref, right.ref);                                           \
-    using std::swap;                                                           \
-    swap(ptr, ref);                                                            \
-    r_delete_number(ptr);                                                      \
-    return *this;                                                              \
-  }
-#define NUM_OP_NAMED(op, name)                                                 \
-  [[nodiscard]] auto Number::op(const Number &right) const -> Number {         \
-    return {name(ref, right.ref), false};                                      \
-  }
-  NUM_OP_MONO(-, r_neg)
-  NUM_OP_MONO(+, r_abs)
-  NUM_OP_MONO(~, r_bit_not)
-  NUM_OP(-=, r_sub)
-  NUM_OP(*=, r_mul)
-  NUM_OP(/=, r_div)
-  NUM_OP(&=, r_bit_and)
-  NUM_OP(%=, r_modu)
-  NUM_OP(^=, r_bit_xor)
-  NUM_OP(+=, r_add)
-  NUM_OP(<<=, r_bit_lshift)
-  NUM_OP(>>=, r_bit_rshift)
-  NUM_OP(|=, r_bit_or)
+    if (std::int64_t result = 0;                                               \
+        is_inline() && right.is_inline() &&                                    \
+        !builtin(inline_value(), right.inline_value(), &result) &&             \
+        fits(result)) {                                                        \
+      ref = tag(result);                                                       \
+      return *this;                                                            \
+    }                                                                          \
+    return *this = promote(name, right);                                       \
+  }
+//! bitwise operations on two inline values, two's complement gives the
+//! same bits as int and the result stays within the inline range
+#define NUM_OP_INLINE(op, name, expr)                                          \
+  auto Number::operator op(const Number & right) -> Number & {                 \
+    if (is_inline() && right.is_inline()) {                                    \
+      ref = tag(inline_value() expr right.inline_value());                     \
+      return *this;                                                            \
+    }                                                                          \
+    return *this = promote(name, right);                                       \
+  }
+  [[nodiscard]] auto Number::operator-() const -> Number {
+    if (is_inline() && fits(-inline_value())) {
+      return from_inline(-inline_value());
+    }
+    return promote(r_neg);
+  }
+  [[nodiscard]] auto Number::operator+() const -> Number {
+    if (is_inline() && fits(-inline_value())) {
+      return from_inline(inline_value() < 0 ? -inline_value()
+                                              : inline_value());
+    }
+    return promote(r_abs);
+  }
+  [[nodiscard]] auto Number::operator~() const -> Number {
+    // ~x == -x - 1 maps the inline range onto itself
+    if (is_inline()) {
+      return from_inline(~inline_value());
+    }
+    return promote(r_bit_not);
+  }
+  NUM_OP_CHECKED(-=, r_sub, __builtin_sub_overflow)
+  NUM_OP_CHECKED(*=, r_mul, __builtin_mul_overflow)
+  NUM_OP_CHECKED(+=, r_add, __builtin_add_overflow)
+  auto Number::operator/=(const Number &right) -> Number & {
+    if (is_inline() && right.is_inline() && right.inline_value() != 0 &&
+        inline_value() % right.inline_value() == 0 &&
+        fits(inline_value() / right.inline_value())) {
+      ref = tag(inline_value() / right.inline_value());
+      return *this;
+    }
+    return *this = promote(r_div, right);
+  }
+  NUM_OP_INLINE(&=, r_bit_and, &)
+  NUM_OP_INLINE(^=, r_bit_xor, ^)
+  NUM_OP_INLINE(|=, r_bit_or, |)
+  auto Number::operator%=(const Number &right) -> Number & {
+    if (is_inline() && right.is_inline() && right.inline_value() != 0) {
+      auto result = inline_value() % right.inline_value();
+      if (result != 0 && (result < 0) != (right.inline_value() < 0)) {
+        result += right.inline_value();
+      }
+      ref = tag(result);
+      return *this;
+    }
+    return *this = promote(r_modu, right);
+  }
+  auto Number::operator<<=(const Number &right) -> Number & {
+    if (is_inline() && right.is_inline() && right.inline_value() >= 0 &&
+        right.inline_value() < std::numeric_limits<std::uint64_t>::digits) {
+      auto result = static_cast<std::int64_t>(
+          static_cast<std::uint64_t>(inline_value())
+          << static_cast<std::uint64_t>(right.inline_value()));
+      if ((result >> right.inline_value()) == inline_value() && fits(result)) {
+        ref = tag(result);
+        return *this;
+      }
+    }
+    return *this = promote(r_bit_lshift, right);
+  }
+  auto Number::operator>>=(const Number &right) -> Number & {
+    if (is_inline() && right.is_inline() && right.inline_value() >= 0) {
+      ref = tag(inline_value() >>
+                std::min<std::int64_t>(right.inline_value(),
+                                       NumericLimits::digits));
+      return *this;
+    }
+    return *this = promote(r_bit_rshift, right);
+  }
   [[nodiscard]] auto Number::operator==(const Number &right) const -> bool {
-    return r_eq(ref, right.ref);
+    if (is_inline() && right.is_inline()) {
+      return ref == right.ref;
+    }
+    const SharedHandle left(share());
+    const SharedHandle other(right.share());
+    return r_eq(left.handle, other.handle);
   }
   [[nodiscard]] auto Number::operator<(const Number &right) const -> bool {
-    return r_lt(ref, right.ref);
+    if (is_inline() && right.is_inline()) {
+      return inline_value() < right.inline_value();
+    }
+    const SharedHandle left(share());
+    const SharedHandle other(right.share());
+    return r_lt(left.handle, other.handle);
   }
   [[nodiscard]] auto Number::floor_div(const Number &right) const -> Number {
-    return {r_floor_div(ref, right.ref), false};
+    if (is_inline() && right.is_inline() && right.inline_value() != 0) {
+      auto result = inline_value() / right.inline_value();
+      if (inline_value() % right.inline_value() != 0 &&
+          (inline_value() < 0) != (right.inline_value() < 0)) {
+        --result;
+      }
+      if (fits(result)) {
+        return from_inline(result);
+      }
+    }
+    return promote(r_floor_div, right);
+  }
+  [[nodiscard]] auto Number::gcd(const Number &right) const -> Number {
+    if (is_inline() && right.is_inline() && inline_value() >= 0 &&
+        right.inline_value() >= 0) {
+      return from_inline(std::gcd(inline_value(), right.inline_value()));
+    }
+    return promote(r_gcd, right);
+  }
+  [[nodiscard]] auto Number::pow(const Number &right) const -> Number {
+    if (is_inline() && right.is_inline() && right.inline_value() >= 0) {
+      std::int64_t result = 1;
+      std::int64_t base = inline_value();
+      bool overflow = false;
+      for (auto exp = right.inline_value(); exp > 0 && !overflow; exp >>= 1) {
+        if ((exp & 1) != 0) {
+          overflow = __builtin_mul_overflow(result, base, &result) ||
+                     !fits(result);
+        }
+        if (exp > 1 && !overflow) {
+          overflow = __builtin_mul_overflow(base, base, &base);
+        }
+      }
+      if (!overflow) {
+        return from_inline(result);
+      }
+    }
+    return promote(r_pow, right);
   }
-  NUM_OP_NAMED(gcd, r_gcd)
-  NUM_OP_NAMED(pow, r_pow)
   [[nodiscard]] auto Number::pow(const Number &exp, const Number &mod) const
       -> Number {
-    return {r_mod_pow(ref, exp.ref, mod.ref), false};
+    const SharedHandle base(share());
+    const SharedHandle exponent(exp.share());
+    const SharedHandle modulus(mod.share());
+    return adopt(r_mod_pow(base.handle, exponent.handle, modulus.handle));
+  }
+  template <typename Result, typename Raw, typename Inline>
+  void Number::batch(gsl::span<const Number> left,
+                     gsl::span<const Number> right, gsl::span<Result> out,
+                     Inline &&fast, Batch<Raw> function) {
+    Expects(left.size() == right.size() && left.size() == out.size());
+    std::vector<std::size_t> indexes;
+    std::vector<PythonNumber> lhs;
+    std::vector<PythonNumber> rhs;
+    // reserved up front so push_back cannot throw while holding a share
+    indexes.reserve(out.size());
+    lhs.reserve(out.size());
+    rhs.reserve(out.size());
+    auto release = gsl::finally([&lhs, &rhs] {
+      for (auto handle : lhs) {
+        r_delete_number(handle);
+      }
+      for (auto handle : rhs) {
+        r_delete_number(handle);
+      }
+    });
+    for (std::size_t idx = 0; idx < out.size(); ++idx) {
+      if (!fast(left[idx], right[idx], out[idx])) {
+        indexes.push_back(idx);
+        lhs.push_back(left[idx].share());
+        rhs.push_back(right[idx].share());
+      }
+    }
+    if (indexes.empty()) {
+      return;
+    }
+    auto results = std::make_unique<Raw[]>(indexes.size());
+    function(lhs.data(), rhs.data(), results.get(), indexes.size());
+    for (std::size_t idx = 0; idx < indexes.size(); ++idx) {
+      if constexpr (std::is_same_v<Result, Number>) {
+        out[indexes[idx]] = adopt(results[idx]);
+      } else {
+        out[indexes[idx]] = results[idx];
+      }
+    }
+  }
+//! batched checked arithmetic, elements that overflow go to rust together
+#define NUM_BATCH_CHECKED(name, batchName, builtin)                            \
+  void Number::name(gsl::span<const Number> left,                              \
+                    gsl::span<const Number> right, gsl::span<Number> out) {    \
+    batch(                                                                     \
+        left, right, out,                                                      \
+        [](const Number &lhs, const Number &rhs, Number &result) {             \
+          if (std::int64_t value = 0;                                          \
+              lhs.is_inline() && rhs.is_inline() &&                            \
+              !builtin(lhs.inline_value(), rhs.inline_value(), &value) &&      \
+              fits(value)) {                                                   \
+            result = from_inline(value);                                       \
+            return true;                                                       \
+          }                                                                    \
+          return false;                                                        \
+        },                                                                     \
+        batchName);                                                            \
+  }
+  NUM_BATCH_CHECKED(add, r_add_batch, __builtin_add_overflow)
+  NUM_BATCH_CHECKED(sub, r_sub_batch, __builtin_sub_overflow)
+  NUM_BATCH_CHECKED(mul, r_mul_batch, __builtin_mul_overflow)
+  void Number::eq(gsl::span<const Number> left, gsl::span<const Number> right,
+                  gsl::span<bool> out) {
+    batch(
+        left, right, out,
+        [](const Number &lhs, const Number &rhs, bool &result) {
+          if (lhs.is_inline() && rhs.is_inline()) {
+            result = lhs.ref == rhs.ref;
+            return true;
+          }
+          return false;
+        },
+        r_eq_batch);
+  }
+  void Number::lt(gsl::span<const Number> left, gsl::span<const Number> right,
+                  gsl::span<bool> out) {
+    batch(
+        left, right, out,
+        [](const Number &lhs, const Number &rhs, bool &result) {
+          if (lhs.is_inline() && rhs.is_inline()) {
+            result = lhs.inline_value() < rhs.inline_value();
+            return true;
+          }
+          return false;
+        },
+        r_lt_batch);
+  }
+  [[nodiscard]] auto Number::sum(gsl::span<const Number> values) -> Number {
+    std::int64_t total = 0;
+    std::vector<PythonNumber> handles;
+    auto release = gsl::finally([&handles] {
+      for (auto handle : handles) {
+        r_delete_number(handle);
+      }
+    });
+    for (const auto &value : values) {
+      if (std::int64_t next = 0;
+          value.is_inline() &&
+          !__builtin_add_overflow(total, value.inline_value(), &next) &&
+          fits(next)) {
+        total = next;
+      } else if (value.is_inline()) {
+        handles.push_back(from_inline(total).share());
+        total = value.inline_value();
+      } else {
+        handles.push_back(value.share());
+      }
+    }
+    if (handles.empty()) {
+      return from_inline(total);
+    }
+    handles.push_back(from_inline(total).share());
+    return adopt(r_sum(handles.data(), handles.size()));
   }
   [[nodiscard]] auto Number::is_complex() const -> bool {
-    return r_is_complex(ref);
+    return !is_inline() && r_is_complex(handle());
+  }
+  [[nodiscard]] auto Number::is_int() const -> bool {
+    return is_inline() || r_is_int(handle());
   }
-  [[nodiscard]] auto Number::is_int() const -> bool { return r_is_int(ref); }
-  [[nodiscard]] auto Number::is_nan() const -> bool { return r_is_nan(ref); }
-  [[nodiscard]] auto Number::imag() const -> Number {
-    return {r_imag(ref), false};
+  [[nodiscard]] auto Number::is_nan() const -> bool {
+    return !is_inline() && r_is_nan(handle());
   }
+  [[nodiscard]] auto Number::imag() const -> Number { return promote(r_imag); }
 } // namespace chimera::library::object::number
 
 // NOLINTEND(cppcoreguidelines-macro-usage)
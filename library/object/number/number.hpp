@@ -3,18 +3,20 @@
 #include <gsl/gsl>
 #include <tao/operators.hpp>
 
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <variant>
-#include <vector>
 
 // NOLINTBEGIN(readability-redundant-declaration)
 using PythonNumber = uint64_t;
 
 extern "C" {
-auto r_repr(uint8_t *buffer, size_t capacity, PythonNumber value) -> int32_t;
-auto r_repr_len(PythonNumber value) -> size_t;
+auto r_repr(uint8_t *buffer, size_t capacity, PythonNumber value) -> size_t;
 } // extern "C"
 // NOLINTEND(readability-redundant-declaration)
 
@@ -59,24 +61,87 @@ namespace chimera::library::object::number {
     [[nodiscard]] auto is_complex() const -> bool;
     [[nodiscard]] auto is_int() const -> bool;
     [[nodiscard]] auto is_nan() const -> bool;
+    //! integers stored inline, every operator on two of them matches int
+    [[nodiscard]] auto is_small() const noexcept -> bool { return is_inline(); }
     [[nodiscard]] auto imag() const -> Number;
+    //! elementwise operations over spans of equal length, small integers are
+    //! handled here and the remainder crosses into rust in a single call
+    static void add(gsl::span<const Number> left, gsl::span<const Number> right,
+                    gsl::span<Number> out);
+    static void sub(gsl::span<const Number> left, gsl::span<const Number> right,
+                    gsl::span<Number> out);
+    static void mul(gsl::span<const Number> left, gsl::span<const Number> right,
+                    gsl::span<Number> out);
+    static void eq(gsl::span<const Number> left, gsl::span<const Number> right,
+                   gsl::span<bool> out);
+    static void lt(gsl::span<const Number> left, gsl::span<const Number> right,
+                   gsl::span<bool> out);
+    [[nodiscard]] static auto sum(gsl::span<const Number> values) -> Number;
     template <typename OStream>
     [[nodiscard]] auto debug(OStream &ostream) const -> OStream & {
       return repr(ostream);
     }
     template <typename OStream>
     auto repr(OStream &ostream) const -> OStream & {
-      auto size = r_repr_len(ref);
-      auto buffer = std::vector<std::uint8_t>(size);
-      if (r_repr(buffer.data(), size, ref) != 0) {
+      if (is_inline()) {
+        return ostream << inline_value();
+      }
+      std::array<char, reprCapacity> buffer{};
+      auto size = represent(buffer.data(), buffer.size());
+      if (size <= buffer.size()) {
+        return ostream << std::string_view(buffer.data(), size);
+      }
+      std::string text(size, '\0');
+      if (represent(text.data(), text.size()) != size) {
         throw std::runtime_error("Failed to represent number");
       }
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-      return ostream << reinterpret_cast<char *>(buffer.data());
+      return ostream << text;
     }
 
   private:
-    Number(PythonNumber ref, bool /*unused*/) noexcept;
+    using Binary = PythonNumber (*)(PythonNumber, PythonNumber);
+    using Unary = PythonNumber (*)(PythonNumber);
+    template <typename Result>
+    using Batch = void (*)(const PythonNumber *, const PythonNumber *,
+                           Result *, size_t);
+    Number(PythonNumber handle, bool /*unused*/) noexcept;
+    [[nodiscard]] static auto from_inline(std::int64_t value) noexcept
+        -> Number;
+    //! takes over a rust result, integers in the inline range are stored
+    //! inline and their handle released
+    [[nodiscard]] static auto adopt(PythonNumber handle) noexcept -> Number;
+    //! small integers are stored shifted left with the low bit set, all other
+    //! values are handles into the rust number table shifted left
+    [[nodiscard]] auto is_inline() const noexcept -> bool {
+      return (ref & 1U) != 0;
+    }
+    [[nodiscard]] auto inline_value() const noexcept -> std::int64_t {
+      return static_cast<std::int64_t>(ref) >> 1;
+    }
+    [[nodiscard]] auto handle() const noexcept -> PythonNumber {
+      return ref >> 1;
+    }
+    //! most numbers print within this many characters without allocating
+    static constexpr std::size_t reprCapacity = 64;
+    //! format a rust number into buffer and return the full length
+    [[nodiscard]] auto represent(char *buffer, std::size_t capacity) const
+        -> std::size_t {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      auto size = r_repr(reinterpret_cast<std::uint8_t *>(buffer), capacity,
+                         handle());
+      if (size == 0) {
+        throw std::runtime_error("Failed to represent number");
+      }
+      return size;
+    }
+    [[nodiscard]] auto share() const -> PythonNumber;
+    [[nodiscard]] auto promote(Binary function, const Number &right) const
+        -> Number;
+    [[nodiscard]] auto promote(Unary function) const -> Number;
+    template <typename Result, typename Raw, typename Inline>
+    static void batch(gsl::span<const Number> left,
+                      gsl::span<const Number> right, gsl::span<Result> out,
+                      Inline &&fast, Batch<Raw> function);
     PythonNumber ref;
   };
 } // namespace chimera::library::object::number
@@ -2,20 +2,26 @@
 
 #pragma once
 
-#include "container/atomic_map.hpp" // for AtomicMap
+#include "container/snapshot_container.hpp" // for SnapshotContainer
 #include "object/number/number.hpp"
 #include "object/reference.hpp"
+#include "object/shape.hpp"  // for InlineCache, Shape
+#include "object/symbol.hpp" // for Symbol
 
+#include <algorithm>   // for sort
+#include <atomic>      // for atomic
 #include <cstdint>     // for uint64_t, uint8_t
 #include <exception>   // for exception
 #include <future>      // for future
 #include <iosfwd>      // for string
+#include <iterator>    // for next
 #include <map>         // for map
 #include <memory>      // for shared_ptr, make_shared, unique_ptr
 #include <optional>    // for optional
 #include <string>      // for basic_string, operator<
+#include <string_view> // for string_view
 #include <type_traits> // for remove_extent_t
-#include <utility>     // for forward, move
+#include <utility>     // for exchange, forward, move
 #include <variant>     // for holds_alternative, variant
 #include <vector>      // for vector
 
@@ -66,9 +72,15 @@ namespace chimera::library::object::internal {
     };
     auto operator=(ObjectPointer<Pointer> &&other) noexcept
         -> ObjectPointer & = default;
-    void delete_attribute(std::string &&key) noexcept { object->erase(key); }
-    void delete_attribute(const std::string &key) noexcept {
-      object->erase(key);
+    //! identity of the referenced object for the garbage collector
+    [[nodiscard]] auto address() const noexcept -> const void * {
+      return object.operator->();
+    }
+    void absolve() const noexcept { object->absolve(); }
+    void clear_attributes() { object->clear(); }
+    void delete_attribute(const Symbol &key) { object->erase(key); }
+    void delete_attribute(std::string_view key) {
+      object->erase(Symbol(key));
     }
     [[nodiscard]] auto dir() const -> std::vector<std::string> {
       return object->dir();
@@ -76,31 +88,63 @@ namespace chimera::library::object::internal {
     [[nodiscard]] auto dir_size() const -> std::size_t {
       return object->dir_size();
     }
+    [[nodiscard]] auto find_attribute(const Symbol &key) const
+        -> std::optional<ObjectPointer<Reference>> {
+      return object->find(key);
+    }
+    [[nodiscard]] auto find_attribute(std::string_view key,
+                                      InlineCache &cache) const
+        -> std::optional<ObjectPointer<Reference>> {
+      return object->find(key, cache);
+    }
     template <typename Type>
     [[nodiscard]] auto get() const noexcept -> std::optional<const Type> {
       return object->template get<Type>();
     }
-    [[nodiscard]] auto get_attribute(std::string &&key) const
-        -> const ObjectPointer<Reference> &;
-    [[nodiscard]] auto get_attribute(const std::string &key) const
-        -> const ObjectPointer<Reference> &;
+    [[nodiscard]] auto get_attribute(const Symbol &key) const
+        -> ObjectPointer<Reference>;
+    [[nodiscard]] auto get_attribute(std::string_view key) const
+        -> ObjectPointer<Reference>;
     [[nodiscard]] auto get_bool() const noexcept -> bool;
-    [[nodiscard]] auto has_attribute(std::string &&key) const noexcept -> bool {
+    [[nodiscard]] auto has_attribute(const Symbol &key) const -> bool {
       return object->contains(key);
     }
-    [[nodiscard]] auto has_attribute(const std::string &key) const noexcept
-        -> bool {
-      return object->contains(key);
+    [[nodiscard]] auto has_attribute(std::string_view key) const -> bool {
+      return object->contains(Symbol(key));
     }
     [[nodiscard]] auto id() const noexcept -> Id {
       using NumericLimits = std::numeric_limits<Id>;
       return NumericLimits::max();
     }
-    template <typename... Args>
-    void set_attribute(Args &&...args) {
-      object->insert_or_assign(std::forward<Args>(args)...);
+    template <typename Visitor>
+    void referents(Visitor &&visitor) const {
+      object->referents(std::forward<Visitor>(visitor));
+    }
+    template <typename Key, typename Value>
+    void set_attribute(Key &&key, Value &&value) {
+      object->insert_or_assign(Symbol(std::forward<Key>(key)),
+                               std::forward<Value>(value));
+    }
+    void set_attribute(std::string_view key, ObjectPointer<Reference> value,
+                       InlineCache &cache) {
+      object->insert_or_assign(key, std::move(value), cache);
+    }
+    //! count references atomically from now on, needed before another
+    //! thread may drop a copy
+    void share() const noexcept { object.share(); }
+    void suspect() const noexcept { object->suspect(); }
+    [[nodiscard]] auto touched() const noexcept -> bool {
+      return object->touched();
     }
     [[nodiscard]] auto use_count() const noexcept { return object.use_count(); }
+    //! changes after every attribute write, empty once a weak target is gone
+    [[nodiscard]] auto version() const noexcept
+        -> std::optional<std::uint32_t> {
+      if (const auto *value = object.operator->(); value != nullptr) {
+        return value->version();
+      }
+      return {};
+    }
     template <typename Visitor>
     auto visit(Visitor &&visitor) const -> decltype(auto) {
       return object->visit(std::forward<Visitor>(visitor));
@@ -151,37 +195,147 @@ namespace chimera::library::object::internal {
                      NullFunction, Number, NumberMethod, ObjectMethod, Stmt,
                      String, StringMethod, SysCall, True, Tuple, TupleMethod>;
     using BasicAttributes = std::map<std::string, ObjectRef>;
-    using Attributes = container::AtomicMap<std::string, ObjectRef>;
+    //! one boxed attribute value, stored over in place when the name is
+    //! already in the shape so readers never see a partial value
+    class Slot {
+    public:
+      explicit Slot(const ObjectRef *box) noexcept : box(box) {}
+      Slot(const Slot &other) noexcept : box(other.get()) {}
+      Slot(Slot &&other) noexcept : box(other.get()) {}
+      ~Slot() noexcept = default;
+      auto operator=(const Slot &other) noexcept -> Slot & {
+        box.store(other.get(), std::memory_order_release);
+        return *this;
+      }
+      auto operator=(Slot &&other) noexcept -> Slot & {
+        box.store(other.get(), std::memory_order_release);
+        return *this;
+      }
+      [[nodiscard]] auto get() const noexcept -> const ObjectRef * {
+        return box.load(std::memory_order_acquire);
+      }
+      //! the previous box, to be retired by the caller
+      [[nodiscard]] auto exchange(const ObjectRef *other) noexcept
+          -> const ObjectRef * {
+        return box.exchange(other, std::memory_order_acq_rel);
+      }
+
+    private:
+      std::atomic<const ObjectRef *> box;
+    };
+    //! attribute values in the slot order of a shared shape, boxed so that
+    //! copying a snapshot never touches reference counts, assigning a name
+    //! the shape has updates its slot in place while adding or removing a
+    //! name copies the values
+    struct Slots {
+      //! a dictionary shape may already hold names added after this
+      //! snapshot was taken
+      [[nodiscard]] auto find(const Symbol &key) const
+          -> std::optional<std::uint32_t> {
+        if (auto slot = shape->find(key); slot && *slot < values.size()) {
+          return slot;
+        }
+        return {};
+      }
+      std::shared_ptr<const Shape> shape = Shape::root();
+      //! on the heap rather than the nursery, the attributes of modules and
+      //! classes outlive the bump chunk they would pin and nothing promotes
+      //! them out of it
+      std::vector<Slot> values{};
+    };
+    //! lookups never lock, they return references by value because a slot
+    //! may be retired as soon as the read section ends
+    using Attributes = container::SnapshotContainer<Slots>;
     Object() = default;
     explicit Object(BasicAttributes &&attributes)
-        : attributes(std::move(attributes)) {}
+        : attributes(make_slots(std::move(attributes))) {}
     template <typename Type>
     Object(BasicAttributes &&attributes, Type &&value)
-        : attributes(std::move(attributes)), value(std::forward<Type>(value)) {}
+        : attributes(make_slots(std::move(attributes))),
+          value(std::forward<Type>(value)) {}
     Object(const Object &other) = delete;
     Object(Object &&other) = delete;
-    ~Object() noexcept = default;
+    ~Object() noexcept {
+      for (const auto &slot : attributes.read().value.values) {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        delete slot.get();
+      }
+    }
     auto operator=(const Object &other) -> Object & = delete;
     auto operator=(Object &&other) noexcept -> Object & = delete;
-    [[nodiscard]] auto at(const std::string &key) const -> const ObjectRef & {
-      return attributes.at(key);
+    //! clears the marks left by the garbage collector
+    void absolve() const noexcept {
+      state.store(0, std::memory_order_relaxed);
+    }
+    //! drops every attribute, only used on an unreachable cycle
+    void clear() {
+      const Change change(*this);
+      auto write = attributes.write();
+      for (const auto &slot : write.value.values) {
+        write.retire(slot.get());
+      }
+      write.value = Slots{};
     }
-    [[nodiscard]] auto contains(const std::string &key) const -> bool {
-      return attributes.contains(key);
+    [[nodiscard]] auto contains(const Symbol &key) const -> bool {
+      auto read = attributes.read();
+      return read.value.find(key).has_value();
     }
     [[nodiscard]] auto dir() const -> std::vector<std::string> {
-      std::vector<std::string> keys(dir_size());
-      auto read = attributes.read();
-      for (const auto &pair : read.value) {
-        keys.emplace_back(pair.first);
+      std::vector<std::string> keys;
+      {
+        auto read = attributes.read();
+        const auto names = read.value.shape->keys();
+        keys.reserve(read.value.values.size());
+        for (std::size_t slot = 0; slot < read.value.values.size(); ++slot) {
+          keys.emplace_back(names[slot].name());
+        }
       }
+      std::sort(keys.begin(), keys.end());
       return keys;
     }
     [[nodiscard]] auto dir_size() const -> std::size_t {
       auto read = attributes.read();
-      return read.value.size();
+      return read.value.values.size();
+    }
+    void erase(const Symbol &key) {
+      const container::EpochGuard guard;
+      touch();
+      const Change change(*this);
+      auto update = attributes.update();
+      if (auto slot = update.value.find(key)) {
+        auto write = update.copy();
+        write.retire(write.value.values[*slot].get());
+        write.value.shape = write.value.shape->remove(key);
+        write.value.values.erase(std::next(write.value.values.begin(), *slot));
+      }
+    }
+    [[nodiscard]] auto find(const Symbol &key) const
+        -> std::optional<ObjectRef> {
+      auto read = attributes.read();
+      if (auto slot = read.value.find(key)) {
+        touch();
+        return *read.value.values[*slot].get();
+      }
+      return {};
+    }
+    //! a cache hit is a shape id compare and an indexed load, only a miss
+    //! interns key and probes the shape
+    [[nodiscard]] auto find(std::string_view key, InlineCache &cache) const
+        -> std::optional<ObjectRef> {
+      auto read = attributes.read();
+      const auto &slots = read.value;
+      if (auto slot = cache.slot(*slots.shape);
+          slot && *slot < slots.values.size()) {
+        touch();
+        return *slots.values[*slot].get();
+      }
+      if (auto slot = slots.find(Symbol(key))) {
+        cache.store(*slots.shape, *slot);
+        touch();
+        return *slots.values[*slot].get();
+      }
+      return {};
     }
-    void erase(const std::string &key) { attributes.erase(key); }
     template <typename Type>
     [[nodiscard]] auto get() const noexcept -> std::optional<const Type> {
       if (auto *result = std::get_if<Type>(&value); result != nullptr) {
@@ -192,9 +346,68 @@ namespace chimera::library::object::internal {
     [[nodiscard]] auto get_bool() const -> bool {
       return std::holds_alternative<True>(value);
     }
-    template <typename... Args>
-    void insert_or_assign(Args &&...args) {
-      attributes.insert_or_assign(std::forward<Args>(args)...);
+    template <typename Type>
+    void insert_or_assign(const Symbol &key, Type &&item) {
+      auto box = std::make_unique<const ObjectRef>(std::forward<Type>(item));
+      const container::EpochGuard guard;
+      touch();
+      const Change change(*this);
+      auto update = attributes.update();
+      if (auto slot = update.value.find(key)) {
+        container::retire(update.value.values[*slot].exchange(box.release()));
+        return;
+      }
+      auto write = update.copy();
+      // a dictionary shape is extended in place, so only once the value
+      // has a slot
+      write.value.values.emplace_back(box.get());
+      write.value.shape = write.value.shape->add(key);
+      box.release();
+    }
+    void insert_or_assign(std::string_view key, ObjectRef &&item,
+                          InlineCache &cache) {
+      auto box = std::make_unique<const ObjectRef>(std::move(item));
+      const container::EpochGuard guard;
+      touch();
+      const Change change(*this);
+      auto update = attributes.update();
+      auto &slots = update.value;
+      if (auto slot = cache.slot(*slots.shape);
+          slot && *slot < slots.values.size()) {
+        container::retire(slots.values[*slot].exchange(box.release()));
+        return;
+      }
+      const Symbol symbol(key);
+      if (auto slot = slots.find(symbol)) {
+        cache.store(*slots.shape, *slot);
+        container::retire(slots.values[*slot].exchange(box.release()));
+        return;
+      }
+      auto write = update.copy();
+      write.value.values.emplace_back(box.get());
+      write.value.shape = write.value.shape->add(symbol);
+      box.release();
+    }
+    //! calls visitor with each attribute value inside one read section
+    template <typename Visitor>
+    void referents(Visitor &&visitor) const {
+      auto read = attributes.read();
+      for (const auto &slot : read.value.values) {
+        visitor(*slot.get());
+      }
+    }
+    //! marks the object as a candidate for freeing, any attribute access
+    //! from now on vetoes it
+    void suspect() const noexcept {
+      state.store(suspectBit, std::memory_order_relaxed);
+    }
+    [[nodiscard]] auto touched() const noexcept -> bool {
+      return (state.load(std::memory_order_acquire) & touchedBit) != 0;
+    }
+    //! read before the attributes it guards, a cache that saw an older
+    //! version than the one now current may hold stale values
+    [[nodiscard]] auto version() const noexcept -> std::uint32_t {
+      return revision.load(std::memory_order_acquire);
     }
     template <typename Visitor>
     auto visit(Visitor &&visitor) const {
@@ -202,8 +415,46 @@ namespace chimera::library::object::internal {
     }
 
   private:
+    static constexpr std::uint8_t suspectBit = 1U;
+    static constexpr std::uint8_t touchedBit = 2U;
+    //! called inside a read section so the collector can wait out any access
+    //! that missed the suspect bit
+    void touch() const noexcept {
+      if ((state.load(std::memory_order_relaxed) & suspectBit) != 0) {
+        state.fetch_or(touchedBit, std::memory_order_release);
+      }
+    }
+    //! made before the write so the new version follows its publication
+    class Change {
+    public:
+      explicit Change(Object &object) noexcept : object(&object) {}
+      Change(const Change &other) = delete;
+      Change(Change &&other) = delete;
+      ~Change() noexcept {
+        object->revision.fetch_add(1, std::memory_order_release);
+      }
+      auto operator=(const Change &other) -> Change & = delete;
+      auto operator=(Change &&other) -> Change & = delete;
+
+    private:
+      Object *object;
+    };
+    [[nodiscard]] static auto make_slots(BasicAttributes &&attributes)
+        -> Slots {
+      Slots slots;
+      slots.values.reserve(attributes.size());
+      for (auto &[key, item] : attributes) {
+        slots.shape = slots.shape->add(Symbol(key));
+        auto box = std::make_unique<const ObjectRef>(std::move(item));
+        slots.values.emplace_back(box.get());
+        box.release();
+      }
+      return slots;
+    }
     Attributes attributes;
     Value value;
+    mutable std::atomic<std::uint8_t> state{0};
+    std::atomic<std::uint32_t> revision{0};
   };
   class BaseException : virtual public std::exception {
   public:
@@ -252,18 +503,18 @@ namespace chimera::library::object::internal {
   };
   template <template <typename...> class Pointer>
   [[nodiscard]] auto
-  ObjectPointer<Pointer>::get_attribute(std::string &&key) const
-      -> const ObjectRef & {
-    return get_attribute(key);
+  ObjectPointer<Pointer>::get_attribute(const Symbol &key) const
+      -> ObjectRef {
+    if (auto value = object->find(key)) {
+      return *std::move(value);
+    }
+    throw AttributeError("object", key.name());
   }
   template <template <typename...> class Pointer>
   [[nodiscard]] auto
-  ObjectPointer<Pointer>::get_attribute(const std::string &key) const
-      -> const ObjectRef & {
-    if (!object->contains(key)) {
-      throw AttributeError("object", key);
-    }
-    return object->at(key);
+  ObjectPointer<Pointer>::get_attribute(std::string_view key) const
+      -> ObjectRef {
+    return get_attribute(Symbol(key));
   }
   template <template <typename...> class Pointer>
   [[nodiscard]] auto ObjectPointer<Pointer>::get_bool() const noexcept -> bool {
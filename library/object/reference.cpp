@@ -2,4 +2,205 @@
 
 #include "reference.hpp"
 
-namespace chimera::library::object {} // namespace chimera::library::object
+#include <atomic>  // for atomic
+#include <cstdint> // for int64_t
+#include <mutex>   // for lock_guard, mutex
+#include <utility> // for exchange, swap
+#include <vector>  // for vector
+
+namespace chimera::library::object {
+  namespace internal {
+    struct Owner {
+      //! guards queue and dead
+      std::mutex mutex;
+      //! objects another thread took below zero, each holds a weak count
+      std::vector<Counts *> queue;
+      //! set once the thread exited, queued objects are then merged by
+      //! whichever thread releases them
+      bool dead = false;
+      std::atomic<bool> pending{false};
+    };
+    //! matches no object, so a thread that never created one always takes
+    //! the shared path
+    static constinit Owner nobody{};
+    constinit thread_local const Owner *threadOwner = &nobody;
+    struct Registry {
+      std::mutex mutex;
+      //! owners of exited threads, never freed because objects still point
+      //! at them, reused by the next thread that needs one
+      std::vector<Owner *> idle;
+    };
+    static auto registry() -> Registry & {
+      //! never destroyed so threads that outlive main can still check out
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      static auto *shared = new Registry();
+      return *shared;
+    }
+    static void destroy(Counts &counts) noexcept {
+      counts.dispose(counts);
+      release_weak(counts);
+    }
+    //! moves the biased count into shared, caller is the owner thread or
+    //! holds the mutex of a dead owner
+    static void merge(Counts &counts, const Owner *owner) noexcept {
+      if (counts.owner.load(std::memory_order_relaxed) != owner) {
+        return;
+      }
+      auto biased =
+          static_cast<std::int64_t>(counts.biased.exchange(0, std::memory_order_relaxed));
+      counts.owner.store(nullptr, std::memory_order_relaxed);
+      auto old = counts.shared.fetch_add(biased * Counts::one + Counts::merged,
+                                         std::memory_order_acq_rel);
+      if (old + biased * Counts::one < Counts::one) {
+        destroy(counts);
+      }
+    }
+    static void drain(Owner &owner) noexcept {
+      std::vector<Counts *> queue;
+      {
+        const std::lock_guard<std::mutex> lock(owner.mutex);
+        owner.pending.store(false, std::memory_order_relaxed);
+        queue.swap(owner.queue);
+      }
+      for (auto *counts : queue) {
+        merge(*counts, &owner);
+        release_weak(*counts);
+      }
+    }
+    static void enqueue(Counts &counts, const Owner *target) noexcept {
+      // the owner merged after our decrement and already counted it
+      if (target == nullptr) {
+        return;
+      }
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      auto &owner = *const_cast<Owner *>(target);
+      counts.weak.fetch_add(1, std::memory_order_relaxed);
+      {
+        const std::lock_guard<std::mutex> lock(owner.mutex);
+        if (owner.dead) {
+          merge(counts, &owner);
+        } else {
+          try {
+            owner.queue.push_back(&counts);
+            owner.pending.store(true, std::memory_order_release);
+            return;
+          } catch (...) {
+            // the owner keeps its count, the object lives until it exits
+          }
+        }
+      }
+      release_weak(counts);
+    }
+    struct Checkout {
+      Checkout() noexcept = default;
+      Checkout(const Checkout &other) = delete;
+      Checkout(Checkout &&other) = delete;
+      //! objects the thread still owns are merged by whoever drops them
+      ~Checkout() noexcept {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        auto *owner = const_cast<Owner *>(std::exchange(threadOwner, &nobody));
+        std::vector<Counts *> queue;
+        {
+          const std::lock_guard<std::mutex> lock(owner->mutex);
+          owner->dead = true;
+          owner->pending.store(false, std::memory_order_relaxed);
+          queue.swap(owner->queue);
+        }
+        for (auto *counts : queue) {
+          merge(*counts, owner);
+          release_weak(*counts);
+        }
+        auto &shared = registry();
+        const std::lock_guard<std::mutex> lock(shared.mutex);
+        try {
+          shared.idle.push_back(owner);
+        } catch (...) {
+        }
+      }
+      auto operator=(const Checkout &other) -> Checkout & = delete;
+      auto operator=(Checkout &&other) -> Checkout & = delete;
+    };
+    [[nodiscard]] auto owner() -> const Owner * {
+      if (threadOwner != &nobody) {
+        return threadOwner;
+      }
+      auto &shared = registry();
+      Owner *owner = nullptr;
+      {
+        const std::lock_guard<std::mutex> lock(shared.mutex);
+        if (!shared.idle.empty()) {
+          owner = shared.idle.back();
+          shared.idle.pop_back();
+        }
+      }
+      if (owner == nullptr) {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        owner = new Owner();
+      }
+      {
+        const std::lock_guard<std::mutex> lock(owner->mutex);
+        owner->dead = false;
+      }
+      threadOwner = owner;
+      thread_local const Checkout checkout;
+      drain(*owner);
+      return owner;
+    }
+    void release_shared(Counts &counts) noexcept {
+      auto old = counts.shared.fetch_sub(Counts::one, std::memory_order_acq_rel);
+      auto now = old - Counts::one;
+      if ((now & Counts::merged) != 0) {
+        if (now < Counts::one) {
+          destroy(counts);
+        }
+        return;
+      }
+      if (now >= 0 || (old & Counts::queued) != 0) {
+        return;
+      }
+      auto flags = counts.shared.fetch_or(Counts::queued, std::memory_order_acq_rel);
+      if ((flags & (Counts::queued | Counts::merged)) == 0) {
+        enqueue(counts, counts.owner.load(std::memory_order_relaxed));
+      }
+    }
+    void release_biased(Counts &counts) noexcept {
+      counts.owner.store(nullptr, std::memory_order_relaxed);
+      auto old = counts.shared.fetch_or(Counts::merged, std::memory_order_acq_rel);
+      if (old < Counts::one) {
+        destroy(counts);
+      }
+    }
+    void release_weak(Counts &counts) noexcept {
+      if (counts.weak.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        counts.deallocate(counts);
+      }
+    }
+    [[nodiscard]] auto try_acquire(Counts &counts) noexcept -> bool {
+      if (counts.owner.load(std::memory_order_relaxed) == threadOwner) {
+        acquire(counts);
+        return true;
+      }
+      auto old = counts.shared.load(std::memory_order_relaxed);
+      do {
+        if ((old & Counts::merged) != 0 && old < Counts::one) {
+          return false;
+        }
+      } while (!counts.shared.compare_exchange_weak(
+          old, old + Counts::one, std::memory_order_acq_rel,
+          std::memory_order_relaxed));
+      return true;
+    }
+    void share(Counts &counts) noexcept {
+      if (counts.owner.load(std::memory_order_relaxed) == threadOwner) {
+        merge(counts, threadOwner);
+      }
+    }
+  } // namespace internal
+  void process_released() noexcept {
+    using internal::threadOwner;
+    if (threadOwner->pending.load(std::memory_order_acquire)) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      internal::drain(*const_cast<internal::Owner *>(threadOwner));
+    }
+  }
+} // namespace chimera::library::object
@@ -2,87 +2,257 @@
 
 #pragma once
 
-#include <memory>      // for shared_ptr, weak_ptr
+#include "container/nursery.hpp" // for nursery_allocate, nursery_deallocate
+
+#include <atomic>      // for atomic
+#include <cstdint>     // for int64_t, uint32_t
+#include <memory>      // for bad_weak_ptr, construct_at, destroy_at
 #include <type_traits> // for add_lvalue_reference, add_pointer_t, enable_if_t
-#include <utility>     // for declval, forward
+#include <utility>     // for exchange, forward
 #include <variant>     // for swap
 
 namespace chimera::library::object {
   namespace internal {
-    template <template <typename...> class Pointer, typename Type>
-    struct CopyReference {
-      [[nodiscard]] auto operator()(const Pointer<Type> &pointer) const noexcept
-          -> std::shared_ptr<Type> {
-        return pointer;
-      }
+    //! one per thread that has created an object
+    struct Owner;
+    //! the owner of the objects this thread creates, null until it creates one
+    extern constinit thread_local const Owner *threadOwner;
+    //! intrusive counts for a biased scheme, the thread that created an
+    //! object counts its references without atomic read modify write
+    //! operations, every other thread uses shared, once the owner's count
+    //! reaches zero it is merged into shared and the object is unowned
+    struct Counts {
+      using Drop = void (*)(Counts &counts) noexcept;
+      //! shared holds the count shifted left by two with these flags below
+      static constexpr std::int64_t merged = 1;
+      static constexpr std::int64_t queued = 2;
+      static constexpr std::int64_t one = 4;
+      std::atomic<const Owner *> owner;
+      //! only written by the owner thread, atomic so other threads can read
+      //! an estimate
+      std::atomic<std::uint32_t> biased{1};
+      //! one for all strong references together
+      std::atomic<std::uint32_t> weak{1};
+      //! may go negative while owned, the owner is then asked to merge
+      std::atomic<std::int64_t> shared{0};
+      Drop dispose;
+      Drop deallocate;
     };
+    //! creates the calling thread's owner on first use
+    [[nodiscard]] auto owner() -> const Owner *;
+    //! a thread other than the owner dropped a reference
+    void release_shared(Counts &counts) noexcept;
+    //! the owner dropped its last biased reference
+    void release_biased(Counts &counts) noexcept;
+    void release_weak(Counts &counts) noexcept;
+    //! strong reference from a weak one, fails once the object is gone
+    [[nodiscard]] auto try_acquire(Counts &counts) noexcept -> bool;
+    //! hands the biased count over to shared so every thread pays the same
+    void share(Counts &counts) noexcept;
+    inline void acquire(Counts &counts) noexcept {
+      if (counts.owner.load(std::memory_order_relaxed) == threadOwner) {
+        counts.biased.store(counts.biased.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+      } else {
+        counts.shared.fetch_add(Counts::one, std::memory_order_relaxed);
+      }
+    }
+    inline void release(Counts &counts) noexcept {
+      if (counts.owner.load(std::memory_order_relaxed) != threadOwner) {
+        release_shared(counts);
+        return;
+      }
+      auto biased = counts.biased.load(std::memory_order_relaxed) - 1;
+      counts.biased.store(biased, std::memory_order_relaxed);
+      if (biased == 0) {
+        release_biased(counts);
+      }
+    }
+    [[nodiscard]] inline auto use_count(const Counts &counts) noexcept -> long {
+      return static_cast<long>(counts.biased.load(std::memory_order_relaxed)) +
+             static_cast<long>(counts.shared.load(std::memory_order_relaxed) >>
+                               2);
+    }
     template <typename Type>
-    struct CopyReference<std::weak_ptr, Type> {
-      [[nodiscard]] auto
-      operator()(const std::weak_ptr<Type> &pointer) const noexcept
-          -> std::shared_ptr<Type> {
-        return pointer.lock();
+    struct Block : Counts {
+      template <typename... Args>
+      explicit Block(Args &&...args)
+          : Counts{.owner = internal::owner(),
+                   .dispose = destroy_value,
+                   .deallocate = destroy_block} {
+        std::construct_at(&value, std::forward<Args>(args)...);
+      }
+      Block(const Block &other) = delete;
+      Block(Block &&other) = delete;
+      ~Block() noexcept {}
+      auto operator=(const Block &other) -> Block & = delete;
+      auto operator=(Block &&other) -> Block & = delete;
+      template <typename... Args>
+      [[nodiscard]] static auto make(Args &&...args) -> Block * {
+        auto *memory =
+            container::nursery_allocate(sizeof(Block), alignof(Block));
+        try {
+          return std::construct_at(static_cast<Block *>(memory),
+                                   std::forward<Args>(args)...);
+        } catch (...) {
+          container::nursery_deallocate(memory, sizeof(Block), alignof(Block));
+          throw;
+        }
+      }
+      union {
+        Type value;
+      };
+
+    private:
+      static void destroy_value(Counts &counts) noexcept {
+        std::destroy_at(&static_cast<Block &>(counts).value);
+      }
+      static void destroy_block(Counts &counts) noexcept {
+        auto *block = &static_cast<Block &>(counts);
+        std::destroy_at(block);
+        container::nursery_deallocate(block, sizeof(Block), alignof(Block));
       }
     };
+    //! tags selecting strong or weak ownership
+    template <typename Type>
+    struct Strong {};
+    template <typename Type>
+    struct Weak {};
     template <typename L, typename R>
     using EnableIfMismatch = std::enable_if_t<!std::is_same_v<L, R>>;
     template <template <typename...> class Pointer, typename Type>
     struct BaseReference {
       using RawPointer = std::add_pointer_t<Type>;
-      BaseReference() : pointer(std::make_shared<Type>()) {}
+      static constexpr bool strong = std::is_same_v<Pointer<Type>, Strong<Type>>;
+      //! most objects die young, they share a bump allocated chunk with
+      //! their counts
+      BaseReference() : block(strong ? Block<Type>::make() : nullptr) {}
       template <typename... Args>
       explicit BaseReference(Args &&...args)
-          : pointer(std::make_shared<Type>(std::forward<Args>(args)...)) {}
+          : block(Block<Type>::make(std::forward<Args>(args)...)) {}
+      BaseReference(const BaseReference &other) noexcept : block(other.block) {
+        retain();
+      }
+      BaseReference(BaseReference &&other) noexcept
+          : block(std::exchange(other.block, nullptr)) {}
       template <
           template <typename...> class InterPointer, typename InterType,
           typename = EnableIfMismatch<Pointer<Type>, InterPointer<InterType>>>
       explicit BaseReference(
           const BaseReference<InterPointer, InterType> &other)
-          : pointer(other.pointer) {}
+          : block(other.block) {
+        if constexpr (strong) {
+          if (block == nullptr || !try_acquire(*block)) {
+            throw std::bad_weak_ptr();
+          }
+        } else {
+          retain();
+        }
+      }
       template <
           template <typename...> class InterPointer, typename InterType,
           typename = EnableIfMismatch<Pointer<Type>, InterPointer<InterType>>>
-      explicit BaseReference(
-          BaseReference<InterPointer, InterType> &&other) noexcept
-          : pointer(std::move(other.pointer)) {}
-      template <template <typename...> class InterPointer, typename InterType>
-      auto operator=(const BaseReference<InterPointer, InterType> &other)
-          -> BaseReference & {
-        pointer = CopyReference<InterPointer, InterType>{}(other.pointer);
+      explicit BaseReference(BaseReference<InterPointer, InterType> &&other)
+          : BaseReference(std::as_const(other)) {
+        other.reset();
+      }
+      ~BaseReference() noexcept { reset(); }
+      auto operator=(const BaseReference &other) noexcept -> BaseReference & {
+        BaseReference(other).swap(*this);
+        return *this;
+      }
+      auto operator=(BaseReference &&other) noexcept -> BaseReference & {
+        BaseReference(std::move(other)).swap(*this);
         return *this;
       }
       template <
           template <typename...> class InterPointer, typename InterType,
           typename = EnableIfMismatch<Pointer<Type>, InterPointer<InterType>>>
-      auto operator=(BaseReference<InterPointer, InterType> &&other) noexcept
+      auto operator=(const BaseReference<InterPointer, InterType> &other)
           -> BaseReference & {
-        pointer = std::move(other.pointer);
+        if constexpr (strong) {
+          BaseReference(Adopt{},
+                        other.block != nullptr && try_acquire(*other.block)
+                            ? other.block
+                            : nullptr)
+              .swap(*this);
+        } else {
+          BaseReference copy(Adopt{}, other.block);
+          copy.retain();
+          copy.swap(*this);
+        }
         return *this;
       }
       template <
           template <typename...> class InterPointer, typename InterType,
           typename = EnableIfMismatch<Pointer<Type>, InterPointer<InterType>>>
-      void swap(BaseReference<InterPointer, InterType> &other) {
+      auto operator=(BaseReference<InterPointer, InterType> &&other)
+          -> BaseReference & {
+        *this = std::as_const(other);
+        other.reset();
+        return *this;
+      }
+      void swap(BaseReference &other) noexcept {
         using std::swap;
-        swap(pointer, other.pointer);
+        swap(block, other.block);
       }
-      [[nodiscard]] auto operator*() const
-          noexcept(noexcept(*std::declval<Pointer<Type>>())) ->
+      [[nodiscard]] auto operator*() const noexcept ->
           typename std::add_lvalue_reference<Type>::type {
-        return *pointer;
+        return *operator->();
       }
       [[nodiscard]] auto operator->() const noexcept -> RawPointer {
-        return CopyReference<Pointer, Type>{}(pointer).get();
+        if constexpr (strong) {
+          return block == nullptr ? nullptr : &block->value;
+        } else {
+          return block == nullptr || use_count() == 0 ? nullptr
+                                                      : &block->value;
+        }
+      }
+      //! stop counting this object on the creating thread only, used before
+      //! handing it to a thread that will drop it
+      void share() const noexcept {
+        if (block != nullptr) {
+          internal::share(*block);
+        }
+      }
+      [[nodiscard]] auto use_count() const noexcept -> long {
+        return block == nullptr ? 0 : internal::use_count(*block);
       }
 
     private:
-      friend BaseReference<std::shared_ptr, Type>;
-      friend BaseReference<std::weak_ptr, Type>;
-      Pointer<Type> pointer;
+      friend BaseReference<Strong, Type>;
+      friend BaseReference<Weak, Type>;
+      struct Adopt {};
+      //! takes over a count already held on block
+      BaseReference(Adopt /*adopt*/, Block<Type> *block) noexcept
+          : block(block) {}
+      void retain() const noexcept {
+        if (block == nullptr) {
+          return;
+        }
+        if constexpr (strong) {
+          acquire(*block);
+        } else {
+          block->weak.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+      void reset() noexcept {
+        if (auto *old = std::exchange(block, nullptr); old != nullptr) {
+          if constexpr (strong) {
+            release(*old);
+          } else {
+            release_weak(*old);
+          }
+        }
+      }
+      Block<Type> *block;
     };
   } // namespace internal
   template <typename Type>
-  using Reference = internal::BaseReference<std::shared_ptr, Type>;
+  using Reference = internal::BaseReference<internal::Strong, Type>;
   template <typename Type>
-  using WeakReference = internal::BaseReference<std::weak_ptr, Type>;
+  using WeakReference = internal::BaseReference<internal::Weak, Type>;
+  //! merges counts other threads released for objects this thread owns,
+  //! cheap enough to call between evaluator steps
+  void process_released() noexcept;
 } // namespace chimera::library::object
@@ -0,0 +1,104 @@
+//! shared attribute layouts and the inline caches keyed on them
+
+#include "object/shape.hpp"
+
+#include <gsl/gsl>
+
+#include <algorithm> // for remove
+#include <mutex>     // for defer_lock, unique_lock
+#include <utility>   // for move
+
+namespace chimera::library::object {
+  //! past this many names an object leaves the shared tree for a dictionary
+  //! shape, so large modules do not fill the tree with copies
+  static constexpr std::size_t sharedLimit = 64;
+  static auto next_shape_id() noexcept -> std::uint64_t {
+    // ids start at one so an empty cache never matches
+    static std::atomic<std::uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+  }
+  Shape::Shape() : shape_id(next_shape_id()) {}
+  Shape::Shape(const Shape &parent, const Symbol &key)
+      : shape_id(next_shape_id()), names(parent.names), slots(parent.slots) {
+    slots.insert_or_assign(key, gsl::narrow<std::uint32_t>(names.size()));
+    names.push_back(key);
+  }
+  Shape::Shape(Dictionary /*unused*/, std::vector<Symbol> &&names)
+      : shape_id(next_shape_id()), names(std::move(names)), dictionary(true) {
+    for (std::uint32_t slot = 0; slot < this->names.size(); ++slot) {
+      slots.insert_or_assign(this->names[slot], slot);
+    }
+  }
+  auto Shape::root() -> const std::shared_ptr<const Shape> & {
+    static const std::shared_ptr<const Shape> shape(new Shape());
+    return shape;
+  }
+  //! a dictionary shape belongs to one object, whose writer lock is held
+  auto Shape::add(const Symbol &key) const -> std::shared_ptr<const Shape> {
+    if (dictionary) {
+      const std::unique_lock<std::shared_mutex> lock(mutex);
+      Expects(!slots.contains(key));
+      slots.insert_or_assign(key, gsl::narrow<std::uint32_t>(names.size()));
+      try {
+        names.push_back(key);
+      } catch (...) {
+        slots.erase(key);
+        throw;
+      }
+      return shared_from_this();
+    }
+    Expects(!slots.contains(key));
+    if (names.size() >= sharedLimit) {
+      auto keys = names;
+      keys.push_back(key);
+      return std::shared_ptr<const Shape>(
+          new Shape(Dictionary{}, std::move(keys)));
+    }
+    {
+      const std::shared_lock<std::shared_mutex> lock(mutex);
+      if (const auto *shape = transitions.find(key); shape != nullptr) {
+        return *shape;
+      }
+    }
+    const std::unique_lock<std::shared_mutex> lock(mutex);
+    auto &shape = transitions[key];
+    if (!shape) {
+      shape.reset(new Shape(*this, key));
+    }
+    return shape;
+  }
+  //! a dictionary shape is copied rather than changed, older snapshots
+  //! still index their values through it
+  auto Shape::remove(const Symbol &key) const -> std::shared_ptr<const Shape> {
+    if (dictionary) {
+      auto keys = this->keys();
+      keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+      return std::shared_ptr<const Shape>(
+          new Shape(Dictionary{}, std::move(keys)));
+    }
+    auto shape = root();
+    for (const auto &name : names) {
+      if (name != key) {
+        shape = shape->add(name);
+      }
+    }
+    return shape;
+  }
+  auto Shape::find(const Symbol &key) const -> std::optional<std::uint32_t> {
+    std::shared_lock<std::shared_mutex> lock(mutex, std::defer_lock);
+    if (dictionary) {
+      lock.lock();
+    }
+    if (const auto *slot = slots.find(key); slot != nullptr) {
+      return *slot;
+    }
+    return {};
+  }
+  auto Shape::keys() const -> std::vector<Symbol> {
+    std::shared_lock<std::shared_mutex> lock(mutex, std::defer_lock);
+    if (dictionary) {
+      lock.lock();
+    }
+    return names;
+  }
+} // namespace chimera::library::object
@@ -0,0 +1,93 @@
+//! shared attribute layouts and the inline caches keyed on them
+
+#pragma once
+
+#include "container/flat_map.hpp" // for FlatMap
+#include "object/symbol.hpp"      // for Symbol
+
+#include <atomic>       // for atomic
+#include <cstdint>      // for uint32_t, uint64_t
+#include <memory>       // for enable_shared_from_this, shared_ptr
+#include <optional>     // for optional
+#include <shared_mutex> // for shared_mutex
+#include <vector>       // for vector
+
+namespace chimera::library::object {
+  //! maps attribute names to slot indexes, objects that gain the same names
+  //! in the same order walk the same transitions and share one shape, past
+  //! sharedLimit names an object gets a dictionary shape of its own that
+  //! later additions extend in place, so slots only ever grow for readers
+  //! still holding the shape from an older snapshot
+  class Shape : public std::enable_shared_from_this<Shape> {
+  public:
+    Shape(const Shape &other) = delete;
+    Shape(Shape &&other) = delete;
+    ~Shape() noexcept = default;
+    auto operator=(const Shape &other) -> Shape & = delete;
+    auto operator=(Shape &&other) -> Shape & = delete;
+    [[nodiscard]] static auto root() -> const std::shared_ptr<const Shape> &;
+    [[nodiscard]] auto add(const Symbol &key) const
+        -> std::shared_ptr<const Shape>;
+    [[nodiscard]] auto remove(const Symbol &key) const
+        -> std::shared_ptr<const Shape>;
+    [[nodiscard]] auto find(const Symbol &key) const
+        -> std::optional<std::uint32_t>;
+    [[nodiscard]] auto id() const noexcept -> std::uint64_t { return shape_id; }
+    //! names in slot order
+    [[nodiscard]] auto keys() const -> std::vector<Symbol>;
+
+  private:
+    struct Dictionary {};
+    Shape();
+    Shape(const Shape &parent, const Symbol &key);
+    Shape(Dictionary /*unused*/, std::vector<Symbol> &&names);
+    std::uint64_t shape_id;
+    //! only a dictionary shape changes these after construction, under the
+    //! mutex
+    mutable std::vector<Symbol> names;
+    mutable container::FlatMap<Symbol, std::uint32_t> slots;
+    bool dictionary = false;
+    mutable std::shared_mutex mutex;
+    mutable container::FlatMap<Symbol, std::shared_ptr<const Shape>>
+        transitions;
+  };
+  //! remembers the slot and shape one name was last found in, so every name
+  //! looked up needs its own cache
+  class InlineCache {
+  public:
+    InlineCache() noexcept = default;
+    InlineCache(const InlineCache &other) noexcept
+        : entry(other.entry.load(std::memory_order_relaxed)) {}
+    InlineCache(InlineCache &&other) noexcept
+        : entry(other.entry.load(std::memory_order_relaxed)) {}
+    ~InlineCache() noexcept = default;
+    auto operator=(const InlineCache &other) noexcept -> InlineCache & {
+      entry.store(other.entry.load(std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+      return *this;
+    }
+    auto operator=(InlineCache &&other) noexcept -> InlineCache & {
+      entry.store(other.entry.load(std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+      return *this;
+    }
+    [[nodiscard]] auto slot(const Shape &shape) const noexcept
+        -> std::optional<std::uint32_t> {
+      auto cached = entry.load(std::memory_order_relaxed);
+      if ((cached >> slotBits) != shape.id()) {
+        return {};
+      }
+      return static_cast<std::uint32_t>(cached & slotMask);
+    }
+    void store(const Shape &shape, std::uint32_t slot) noexcept {
+      if (slot <= slotMask) {
+        entry.store((shape.id() << slotBits) | slot, std::memory_order_relaxed);
+      }
+    }
+
+  private:
+    static constexpr std::uint64_t slotBits = 16;
+    static constexpr std::uint64_t slotMask = (1U << slotBits) - 1;
+    std::atomic<std::uint64_t> entry{0};
+  };
+} // namespace chimera::library::object
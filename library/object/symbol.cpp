@@ -0,0 +1,45 @@
+//! interned attribute names
+
+#include "object/symbol.hpp"
+
+#include <gsl/gsl>
+
+#include <deque>         // for deque
+#include <mutex>         // for unique_lock
+#include <shared_mutex>  // for shared_mutex, shared_lock
+#include <unordered_map> // for unordered_map
+
+namespace chimera::library::object {
+  struct SymbolTable {
+    std::shared_mutex mutex;
+    //! keys view into names, deque growth never moves existing strings
+    std::unordered_map<std::string_view, std::uint32_t> ids;
+    std::deque<std::string> names;
+  };
+  static auto symbol_table() -> SymbolTable & {
+    static SymbolTable table;
+    return table;
+  }
+  static auto intern(std::string_view name) -> std::uint32_t {
+    auto &table = symbol_table();
+    {
+      const std::shared_lock<std::shared_mutex> lock(table.mutex);
+      if (auto found = table.ids.find(name); found != table.ids.end()) {
+        return found->second;
+      }
+    }
+    const std::unique_lock<std::shared_mutex> lock(table.mutex);
+    if (auto found = table.ids.find(name); found != table.ids.end()) {
+      return found->second;
+    }
+    auto id = gsl::narrow<std::uint32_t>(table.names.size());
+    table.ids.emplace(table.names.emplace_back(name), id);
+    return id;
+  }
+  Symbol::Symbol(std::string_view name) : symbol(intern(name)) {}
+  auto Symbol::name() const -> const std::string & {
+    auto &table = symbol_table();
+    const std::shared_lock<std::shared_mutex> lock(table.mutex);
+    return table.names[symbol];
+  }
+} // namespace chimera::library::object
@@ -0,0 +1,40 @@
+//! interned attribute names
+
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint32_t, uint64_t
+#include <functional>  // for hash
+#include <string>      // for string
+#include <string_view> // for string_view
+
+namespace chimera::library::object {
+  //! a name interned into a process wide table, equal names share an id so
+  //! comparing and hashing never touch the characters
+  class Symbol {
+  public:
+    explicit Symbol(std::string_view name);
+    [[nodiscard]] auto id() const noexcept -> std::uint32_t { return symbol; }
+    [[nodiscard]] auto name() const -> const std::string &;
+    [[nodiscard]] auto operator==(const Symbol &other) const noexcept -> bool {
+      return symbol == other.symbol;
+    }
+    [[nodiscard]] auto operator<(const Symbol &other) const noexcept -> bool {
+      return symbol < other.symbol;
+    }
+
+  private:
+    std::uint32_t symbol;
+  };
+} // namespace chimera::library::object
+
+template <>
+struct std::hash<chimera::library::object::Symbol> {
+  [[nodiscard]] auto
+  operator()(const chimera::library::object::Symbol &symbol) const noexcept
+      -> std::size_t {
+    //! ids are dense so an odd multiplier keeps the low bits distinct
+    return static_cast<std::size_t>(std::uint64_t{symbol.id()} *
+                                    0x9E3779B97F4A7C15U);
+  }
+};
@@ -26,6 +26,8 @@ namespace chimera::library {
     gsl::span<const char *> argv{};
     options::BytesCompare bytes_compare = options::BytesCompare::NONE;
     const char *chimera = nullptr;
+    //! -X replay_loops, hot loop bodies replay recorded steps
+    bool replay_loops = false;
     bool debug = false;
     bool disable_site = false;
     bool dont_add_site = false;
@@ -3,280 +3,205 @@
 
 #include "virtual_machine/bin_evaluator.hpp"
 
+#include "object/number/number.hpp"
 #include "virtual_machine/evaluator.hpp"
+#include "virtual_machine/step_profile.hpp"
+
+#include <iterator>    // for next
+#include <optional>    // for optional
+#include <string_view> // for string_view
+
+using namespace std::literals;
 
 namespace chimera::library::virtual_machine {
-  BinAddEvaluator::BinAddEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinAddEvaluator(exprs.begin(), exprs.end()) {}
-  BinAddEvaluator::BinAddEvaluator(
-      const BinAddEvaluator::Iterator &begin,
-      const BinAddEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinAddEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinAddEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__add__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+  [[nodiscard]] static auto method(asdl::Operator op) noexcept
+      -> std::string_view {
+    switch (op) {
+      case asdl::Operator::ADD:
+        return "__add__"sv;
+      case asdl::Operator::SUB:
+        return "__sub__"sv;
+      case asdl::Operator::MULT:
+        return "__mul__"sv;
+      case asdl::Operator::MAT_MULT:
+        return "__matmul__"sv;
+      case asdl::Operator::DIV:
+        return "__div__"sv;
+      case asdl::Operator::MOD:
+        return "__mod__"sv;
+      case asdl::Operator::POW:
+        return "__pow__"sv;
+      case asdl::Operator::L_SHIFT:
+        return "__lshift__"sv;
+      case asdl::Operator::R_SHIFT:
+        return "__rshift__"sv;
+      case asdl::Operator::BIT_OR:
+        return "__or__"sv;
+      case asdl::Operator::BIT_XOR:
+        return "__xor__"sv;
+      case asdl::Operator::BIT_AND:
+        return "__and__"sv;
+      case asdl::Operator::FLOOR_DIV:
+        return "__floordiv__"sv;
     }
+    return {};
   }
-  BinSubEvaluator::BinSubEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinSubEvaluator(exprs.begin(), exprs.end()) {}
-  BinSubEvaluator::BinSubEvaluator(
-      const BinSubEvaluator::Iterator &begin,
-      const BinSubEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinSubEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinSubEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__sub__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+  //! literals carry no class, anything else must be an instance of int
+  //! itself so subclasses keep their own methods
+  [[nodiscard]] static auto builtin_int(const Evaluator *evaluator,
+                                        const object::Object &object)
+      -> std::optional<object::Number> {
+    auto number = object.get<object::Number>();
+    if (!number || !number->is_int()) {
+      return {};
     }
-  }
-  BinMultEvaluator::BinMultEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinMultEvaluator(exprs.begin(), exprs.end()) {}
-  BinMultEvaluator::BinMultEvaluator(
-      const BinMultEvaluator::Iterator &begin,
-      const BinMultEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinMultEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinMultEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__mul__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+    static const object::Symbol classSymbol("__class__");
+    if (auto type = object.find_attribute(classSymbol)) {
+      static const object::Symbol intSymbol("int");
+      auto builtin = evaluator->builtins().find_attribute(intSymbol);
+      if (!builtin || builtin->address() != type->address()) {
+        return {};
+      }
     }
+    return number;
   }
-  BinMatMultEvaluator::BinMatMultEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinMatMultEvaluator(exprs.begin(), exprs.end()) {}
-  BinMatMultEvaluator::BinMatMultEvaluator(
-      const BinMatMultEvaluator::Iterator &begin,
-      const BinMatMultEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinMatMultEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinMatMultEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__matmul__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
-    }
+  //! rust numbers keep a sign and a magnitude, so operators that floor or
+  //! work on two's complement bits only match int for small negatives
+  [[nodiscard]] static auto exact(const object::Number &left,
+                                  const object::Number &right) -> bool {
+    static const object::Number zero(0U);
+    return (left.is_small() && right.is_small()) ||
+           (!(left < zero) && !(right < zero));
   }
-  BinDivEvaluator::BinDivEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinDivEvaluator(exprs.begin(), exprs.end()) {}
-  BinDivEvaluator::BinDivEvaluator(
-      const BinDivEvaluator::Iterator &begin,
-      const BinDivEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinDivEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinDivEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__div__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+  //! empty where the result would not be an int or the operation raises,
+  //! those go through the methods of int
+  [[nodiscard]] static auto apply(asdl::Operator op, object::Number left,
+                                  const object::Number &right)
+      -> std::optional<object::Number> {
+    static const object::Number zero(0U);
+    switch (op) {
+      case asdl::Operator::ADD:
+        return left += right;
+      case asdl::Operator::SUB:
+        return left -= right;
+      case asdl::Operator::MULT:
+        return left *= right;
+      case asdl::Operator::MOD:
+        if (right == zero || !exact(left, right)) {
+          return {};
+        }
+        return left %= right;
+      case asdl::Operator::POW:
+        if (right < zero) {
+          return {};
+        }
+        return left.pow(right);
+      case asdl::Operator::L_SHIFT:
+        if (right < zero) {
+          return {};
+        }
+        return left <<= right;
+      case asdl::Operator::R_SHIFT:
+        if (right < zero || !exact(left, right)) {
+          return {};
+        }
+        return left >>= right;
+      case asdl::Operator::BIT_OR:
+        if (!exact(left, right)) {
+          return {};
+        }
+        return left |= right;
+      case asdl::Operator::BIT_XOR:
+        if (!exact(left, right)) {
+          return {};
+        }
+        return left ^= right;
+      case asdl::Operator::BIT_AND:
+        if (!exact(left, right)) {
+          return {};
+        }
+        return left &= right;
+      case asdl::Operator::FLOOR_DIV:
+        if (right == zero || !exact(left, right)) {
+          return {};
+        }
+        return left.floor_div(right);
+      case asdl::Operator::MAT_MULT:
+      case asdl::Operator::DIV:
+        break;
     }
+    return {};
   }
-  BinModEvaluator::BinModEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinModEvaluator(exprs.begin(), exprs.end()) {}
-  BinModEvaluator::BinModEvaluator(
-      const BinModEvaluator::Iterator &begin,
-      const BinModEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinModEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinModEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__mod__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+  //! the step for the operator of bin, as quickened so far
+  static void push_operator(Evaluator *evaluator, const asdl::Bin &bin) {
+    if (bin.quickening.kind() == asdl::Quickening::INT) {
+      return evaluator->push(BinIntTop{bin});
     }
+    evaluator->push(BinNumberTop{bin});
   }
-  BinPowEvaluator::BinPowEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinPowEvaluator(exprs.begin(), exprs.end()) {}
-  BinPowEvaluator::BinPowEvaluator(
-      const BinPowEvaluator::Iterator &begin,
-      const BinPowEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinPowEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinPowEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__pow__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+  BinNumberTop::BinNumberTop(const asdl::Bin &bin) noexcept : bin(&bin) {}
+  void BinNumberTop::operator()(Evaluator *evaluator) const {
+    auto right = evaluator->stack_remove();
+    if (auto rightNumber = builtin_int(evaluator, right)) {
+      if (auto leftNumber = builtin_int(evaluator, evaluator->stack_top())) {
+        if (auto result = apply(bin->op, *std::move(leftNumber),
+                                *rightNumber)) {
+          evaluator->stack_top_update(object::Object(*std::move(result), {}));
+          if (bin->quickening.observe(asdl::Quickening::INT) &&
+              profile::enabled()) {
+            profile::record(profile::Quickened::SPECIALISED);
+          }
+          return;
+        }
+      }
     }
+    bin->quickening.observe(asdl::Quickening::GENERIC);
+    evaluator->stack_push(right);
+    evaluator->push(CallTop{});
+    evaluator->push(LoadMethod{method(bin->op)});
   }
-  BinLShiftEvaluator::BinLShiftEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinLShiftEvaluator(exprs.begin(), exprs.end()) {}
-  BinLShiftEvaluator::BinLShiftEvaluator(
-      const BinLShiftEvaluator::Iterator &begin,
-      const BinLShiftEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinLShiftEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinLShiftEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__lshift__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
-    }
-  }
-  BinRShiftEvaluator::BinRShiftEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinRShiftEvaluator(exprs.begin(), exprs.end()) {}
-  BinRShiftEvaluator::BinRShiftEvaluator(
-      const BinRShiftEvaluator::Iterator &begin,
-      const BinRShiftEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinRShiftEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinRShiftEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__rshift__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
-    }
-  }
-  BinBitOrEvaluator::BinBitOrEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinBitOrEvaluator(exprs.begin(), exprs.end()) {}
-  BinBitOrEvaluator::BinBitOrEvaluator(
-      const BinBitOrEvaluator::Iterator &begin,
-      const BinBitOrEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinBitOrEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinBitOrEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__or__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+  //! ints without attributes, which are never subclasses
+  [[nodiscard]] static auto plain_int(const object::Object &object)
+      -> std::optional<object::Number> {
+    auto number = object.get<object::Number>();
+    if (number && number->is_int() && object.dir_size() == 0) {
+      return number;
     }
+    return {};
   }
-  BinBitXorEvaluator::BinBitXorEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinBitXorEvaluator(exprs.begin(), exprs.end()) {}
-  BinBitXorEvaluator::BinBitXorEvaluator(
-      const BinBitXorEvaluator::Iterator &begin,
-      const BinBitXorEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinBitXorEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinBitXorEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__xor__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+  BinIntTop::BinIntTop(const asdl::Bin &bin) noexcept : bin(&bin) {}
+  void BinIntTop::operator()(Evaluator *evaluator) const {
+    auto right = evaluator->stack_remove();
+    if (auto rightNumber = plain_int(right)) {
+      if (auto leftNumber = plain_int(evaluator->stack_top())) {
+        if (auto result = apply(bin->op, *std::move(leftNumber),
+                                *rightNumber)) {
+          evaluator->stack_top_update(object::Object(*std::move(result), {}));
+          if (profile::enabled()) {
+            profile::record(profile::Quickened::HIT);
+          }
+          return;
+        }
+      }
     }
-  }
-  BinBitAndEvaluator::BinBitAndEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinBitAndEvaluator(exprs.begin(), exprs.end()) {}
-  BinBitAndEvaluator::BinBitAndEvaluator(
-      const BinBitAndEvaluator::Iterator &begin,
-      const BinBitAndEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinBitAndEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
-      const auto &expr = *begin;
-      evaluatorA->push(BinBitAndEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__and__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+    if (profile::enabled()) {
+      profile::record(profile::Quickened::MISS);
     }
+    bin->quickening.deoptimize();
+    evaluator->stack_push(right);
+    BinNumberTop{*bin}(evaluator);
   }
-  BinFloorDivEvaluator::BinFloorDivEvaluator(
-      const std::vector<asdl::ExprImpl> &exprs) noexcept
-      : BinFloorDivEvaluator(exprs.begin(), exprs.end()) {}
-  BinFloorDivEvaluator::BinFloorDivEvaluator(
-      const BinFloorDivEvaluator::Iterator &begin,
-      const BinFloorDivEvaluator::Iterator &end) noexcept
-      : begin(begin), end(end) {}
-  void BinFloorDivEvaluator::operator()(Evaluator *evaluatorA) const {
-    if (begin != end) {
+  BinEvaluator::BinEvaluator(const asdl::Bin &bin) noexcept
+      : BinEvaluator(bin, std::next(bin.values.begin())) {}
+  BinEvaluator::BinEvaluator(const asdl::Bin &bin,
+                             const BinEvaluator::Iterator &begin) noexcept
+      : bin(&bin), begin(begin) {}
+  void BinEvaluator::operator()(Evaluator *evaluator) const {
+    if (begin != bin->values.end()) {
       const auto &expr = *begin;
-      evaluatorA->push(BinFloorDivEvaluator{begin + 1, end});
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        evaluatorB->get_attribute(evaluatorB->stack_top(), "__floordiv__");
-        evaluatorB->stack_pop();
-      });
-      evaluatorA->evaluate_get(expr);
+      evaluator->push(BinEvaluator{*bin, begin + 1});
+      push_operator(evaluator, *bin);
+      evaluator->evaluate_get(expr);
     }
   }
 } // namespace chimera::library::virtual_machine
@@ -5,146 +5,42 @@
 
 #include "asdl/asdl.hpp"
 
+#include <string_view>
 #include <vector>
 
 namespace chimera::library::virtual_machine {
   struct Evaluator;
-  struct BinAddEvaluator {
-    explicit BinAddEvaluator(const std::vector<asdl::ExprImpl> &exprs) noexcept;
+  //! evaluates each operand after the first and pushes the step bin.op
+  //! combines it with
+  struct BinEvaluator {
+    static constexpr std::string_view profile_name = "BinEvaluator";
+    explicit BinEvaluator(const asdl::Bin &bin) noexcept;
     void operator()(Evaluator *evaluator) const;
 
   private:
     using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinAddEvaluator(const Iterator &begin, const Iterator &end) noexcept;
+    BinEvaluator(const asdl::Bin &bin, const Iterator &begin) noexcept;
+    const asdl::Bin *bin;
     Iterator begin;
-    Iterator end;
   };
-  struct BinSubEvaluator {
-    explicit BinSubEvaluator(const std::vector<asdl::ExprImpl> &exprs) noexcept;
+  //! with both operands on the stack, combines builtin ints in place and
+  //! otherwise calls the method of the operator
+  struct BinNumberTop {
+    static constexpr std::string_view profile_name = "BinNumberTop";
+    explicit BinNumberTop(const asdl::Bin &bin) noexcept;
     void operator()(Evaluator *evaluator) const;
 
   private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinSubEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinMultEvaluator {
-    explicit BinMultEvaluator(
-        const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinMultEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinMatMultEvaluator {
-    explicit BinMatMultEvaluator(
-        const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinMatMultEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinDivEvaluator {
-    explicit BinDivEvaluator(const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinDivEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinModEvaluator {
-    explicit BinModEvaluator(const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinModEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinPowEvaluator {
-    explicit BinPowEvaluator(const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinPowEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
+    const asdl::Bin *bin;
   };
-  struct BinLShiftEvaluator {
-    explicit BinLShiftEvaluator(
-        const std::vector<asdl::ExprImpl> &exprs) noexcept;
+  //! replaces BinNumberTop once bin kept seeing plain ints, only checks the
+  //! operands are ints without attributes and falls back on a miss
+  struct BinIntTop {
+    static constexpr std::string_view profile_name = "BinIntTop";
+    explicit BinIntTop(const asdl::Bin &bin) noexcept;
     void operator()(Evaluator *evaluator) const;
 
   private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinLShiftEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinRShiftEvaluator {
-    explicit BinRShiftEvaluator(
-        const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinRShiftEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinBitOrEvaluator {
-    explicit BinBitOrEvaluator(
-        const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinBitOrEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinBitXorEvaluator {
-    explicit BinBitXorEvaluator(
-        const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinBitXorEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinBitAndEvaluator {
-    explicit BinBitAndEvaluator(
-        const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinBitAndEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
-  };
-  struct BinFloorDivEvaluator {
-    explicit BinFloorDivEvaluator(
-        const std::vector<asdl::ExprImpl> &exprs) noexcept;
-    void operator()(Evaluator *evaluator) const;
-
-  private:
-    using Iterator = std::vector<asdl::ExprImpl>::const_iterator;
-    BinFloorDivEvaluator(const Iterator &begin, const Iterator &end) noexcept;
-    Iterator begin;
-    Iterator end;
+    const asdl::Bin *bin;
   };
 } // namespace chimera::library::virtual_machine
@@ -20,9 +20,7 @@ namespace chimera::library::virtual_machine {
         evaluator->stack_pop();
         const auto &expr = *begin;
         evaluator->push(BoolAndEvaluator{begin + 1, end});
-        evaluator->push([](Evaluator *evaluatorB) {
-          evaluatorB->push(ToBoolEvaluator{evaluatorB->stack_top()});
-        });
+        evaluator->push(ToBoolTop{});
         evaluator->evaluate_get(expr);
       }
     }
@@ -41,9 +39,7 @@ namespace chimera::library::virtual_machine {
         evaluator->stack_pop();
         const auto &expr = *begin;
         evaluator->push(BoolOrEvaluator{begin + 1, end});
-        evaluator->push([](Evaluator *evaluatorB) {
-          evaluatorB->push(ToBoolEvaluator{evaluatorB->stack_top()});
-        });
+        evaluator->push(ToBoolTop{});
         evaluator->evaluate_get(expr);
       }
     }
@@ -5,11 +5,13 @@
 
 #include "asdl/asdl.hpp"
 
+#include <string_view>
 #include <vector>
 
 namespace chimera::library::virtual_machine {
   struct Evaluator;
   struct BoolAndEvaluator {
+    static constexpr std::string_view profile_name = "BoolAndEvaluator";
     explicit BoolAndEvaluator(
         const std::vector<asdl::ExprImpl> &exprs) noexcept;
     void operator()(Evaluator *evaluator) const;
@@ -21,6 +23,7 @@ namespace chimera::library::virtual_machine {
     Iterator end;
   };
   struct BoolOrEvaluator {
+    static constexpr std::string_view profile_name = "BoolOrEvaluator";
     explicit BoolOrEvaluator(const std::vector<asdl::ExprImpl> &exprs) noexcept;
     void operator()(Evaluator *evaluator) const;
 
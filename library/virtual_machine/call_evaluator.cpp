@@ -9,19 +9,17 @@
 #include <gsl/gsl>
 
 namespace chimera::library::virtual_machine {
-  struct UnpackCallObject {
-    template <typename Value>
-    [[noreturn]] void evaluate(const Evaluator * /*evaluator*/,
-                               const Value & /*exprImpl*/) const {
-      Expects(false);
-    }
-    void operator()(Evaluator *evaluator) const {
-      auto object = evaluator->stack_remove();
-      object.visit([this, evaluator](auto &&value) {
-        this->evaluate(evaluator, value);
-      });
-    }
-  };
+  template <typename Value>
+  [[noreturn]] static void unpack_call(const Evaluator *evaluator,
+                                       const Value & /*exprImpl*/) {
+    throw object::BaseException(
+        evaluator->builtins().get_attribute("NotImplementedError"));
+  }
+  void UnpackCallObject::operator()(Evaluator *evaluator) const {
+    auto object = evaluator->stack_remove();
+    object.visit(
+        [evaluator](auto &&value) { unpack_call(evaluator, value); });
+  }
   CallEvaluator::CallEvaluator(object::Object object) noexcept
       : object(std::move(object)) {}
   CallEvaluator::CallEvaluator(object::Object object,
@@ -29,9 +27,7 @@ namespace chimera::library::virtual_machine {
       : object(std::move(object)), args(std::move(args)) {}
   void CallEvaluator::operator()(Evaluator *evaluatorA) const {
     if (object.get<object::Instance>()) {
-      evaluatorA->push([](Evaluator *evaluatorB) {
-        std::ignore = evaluatorB->stack_remove();
-      });
+      evaluatorA->push(PopStack{});
       evaluatorA->get_attribute(object, "__call__");
     } else {
       evaluatorA->push(UnpackCallObject{});
@@ -6,10 +6,16 @@
 #include "object/object.hpp"
 
 #include <optional>
+#include <string_view>
 
 namespace chimera::library::virtual_machine {
   struct Evaluator;
+  struct UnpackCallObject {
+    static constexpr std::string_view profile_name = "UnpackCallObject";
+    void operator()(Evaluator *evaluator) const;
+  };
   struct CallEvaluator {
+    static constexpr std::string_view profile_name = "CallEvaluator";
     explicit CallEvaluator(object::Object object) noexcept;
     CallEvaluator(object::Object object, object::Tuple args) noexcept;
     void operator()(Evaluator *evaluatorA) const;
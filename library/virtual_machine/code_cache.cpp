@@ -0,0 +1,134 @@
+//! parsed modules kept beside their source in __pycache__ so later imports
+//! skip the parser
+
+#include "virtual_machine/code_cache.hpp"
+
+#include "asdl/asdl.hpp"
+#include "asdl/serialize.hpp"
+#include "container/mapped_file.hpp"
+#include "options.hpp"
+
+#include <gsl/gsl>
+
+#include <unistd.h> // for getpid
+
+#include <atomic>       // for atomic
+#include <cstdint>      // for uint64_t
+#include <cstring>      // for memcpy
+#include <exception>    // for exception
+#include <filesystem>   // for path, file_size, last_write_time
+#include <fstream>      // for ofstream
+#include <optional>     // for optional
+#include <stdexcept>    // for runtime_error
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <system_error> // for error_code
+
+namespace chimera::library::virtual_machine {
+  //! "CHIMAST" read as a little endian integer
+  static constexpr std::uint64_t cacheMagic = 0x0054'5341'4D49'4843U;
+  //! bump whenever the asdl structures or their serialized form change
+  static constexpr std::uint32_t cacheVersion = 1;
+  //! FNV-1a, only guards against stale or torn files
+  [[nodiscard]] static auto fingerprint(std::string_view data) noexcept
+      -> std::uint64_t {
+    std::uint64_t hash = 0xCBF2'9CE4'8422'2325U;
+    for (auto byte : data) {
+      hash ^= static_cast<std::uint8_t>(byte);
+      hash *= 0x0000'0100'0000'01B3U;
+    }
+    return hash;
+  }
+  CodeCache::CodeCache(const std::string &source,
+                       const options::Optimize &optimize) {
+    const std::filesystem::path path(source);
+    auto name = path.stem().string().append(".chimera");
+    if (optimize != options::Optimize::NONE) {
+      name.append(".opt-").append(std::to_string(static_cast<int>(optimize)));
+    }
+    cache = path.parent_path() / "__pycache__" / name.append(".ast");
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    if (error) {
+      return;
+    }
+    auto mtime = std::filesystem::last_write_time(path, error);
+    if (error) {
+      return;
+    }
+    const container::MappedFile mapped(source.c_str());
+    if (mapped.view().size() != size) {
+      return;
+    }
+    header = Header{
+        .magic = cacheMagic,
+        .version = cacheVersion,
+        .optimize = static_cast<std::uint32_t>(optimize),
+        .size = size,
+        .mtime = static_cast<std::int64_t>(mtime.time_since_epoch().count()),
+        .source_hash = fingerprint(mapped.view()),
+        .payload_hash = 0,
+    };
+  }
+  [[nodiscard]] auto CodeCache::load() const -> std::optional<asdl::Module> {
+    if (!header) {
+      return {};
+    }
+    const container::MappedFile mapped(cache.c_str());
+    auto data = mapped.view();
+    if (data.size() < sizeof(Header)) {
+      return {};
+    }
+    Header stored{};
+    std::memcpy(&stored, data.data(), sizeof(Header));
+    data.remove_prefix(sizeof(Header));
+    auto expected = *header;
+    expected.payload_hash = fingerprint(data);
+    if (stored != expected) {
+      return {};
+    }
+    try {
+      return asdl::deserialize(data);
+    } catch (const std::runtime_error &) {
+      return {};
+    }
+  }
+  void CodeCache::store(const asdl::Module &module) const noexcept {
+    static std::atomic<std::uint64_t> sequence{};
+    if (!header) {
+      return;
+    }
+    try {
+      const auto payload = asdl::serialize(module);
+      auto stored = *header;
+      stored.payload_hash = fingerprint(payload);
+      std::filesystem::create_directories(cache.parent_path());
+      auto temporary = cache;
+      temporary += "." + std::to_string(::getpid()) + "." +
+                   std::to_string(sequence++) + ".tmp";
+      bool renamed = false;
+      auto cleanup = gsl::finally([&temporary, &renamed] {
+        if (!renamed) {
+          std::error_code error;
+          std::filesystem::remove(temporary, error);
+        }
+      });
+      {
+        std::ofstream output(temporary, std::ios::binary | std::ios::trunc);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        output.write(reinterpret_cast<const char *>(&stored), sizeof(Header));
+        output.write(payload.data(),
+                     static_cast<std::streamsize>(payload.size()));
+        if (!output.flush()) {
+          return;
+        }
+      }
+      std::filesystem::rename(temporary, cache);
+      renamed = true;
+    } catch (const std::exception &) {
+    }
+  }
+  [[nodiscard]] auto CodeCache::path() const -> const std::filesystem::path & {
+    return cache;
+  }
+} // namespace chimera::library::virtual_machine
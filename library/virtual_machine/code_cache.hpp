@@ -0,0 +1,39 @@
+//! parsed modules kept beside their source in __pycache__ so later imports
+//! skip the parser
+
+#pragma once
+
+#include "asdl/asdl.hpp"
+#include "options.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace chimera::library::virtual_machine {
+  //! cache entry for one source file, an entry written for a different size,
+  //! modification time, content, or optimize level is ignored and replaced on
+  //! the next store
+  struct CodeCache {
+    CodeCache(const std::string &source, const options::Optimize &optimize);
+    [[nodiscard]] auto load() const -> std::optional<asdl::Module>;
+    //! failing to write is not an error, the module is parsed again next time
+    void store(const asdl::Module &module) const noexcept;
+    [[nodiscard]] auto path() const -> const std::filesystem::path &;
+
+  private:
+    struct Header {
+      std::uint64_t magic;
+      std::uint32_t version;
+      std::uint32_t optimize;
+      std::uint64_t size;
+      std::int64_t mtime;
+      std::uint64_t source_hash;
+      std::uint64_t payload_hash;
+      friend auto operator==(const Header &, const Header &) -> bool = default;
+    };
+    std::filesystem::path cache;
+    std::optional<Header> header{};
+  };
+} // namespace chimera::library::virtual_machine
@@ -11,11 +11,7 @@ namespace chimera::library::virtual_machine {
   DelEvaluator::DelEvaluator(Evaluator *evaluator) noexcept
       : evaluator(evaluator) {}
   void DelEvaluator::evaluate(const asdl::Attribute &attribute) const {
-    evaluator->push([&attribute](Evaluator *evaluatorA) {
-      auto top = evaluatorA->stack_top();
-      top.delete_attribute(attribute.attr.value);
-      evaluatorA->stack_pop();
-    });
+    evaluator->push(DelAttributeTop{attribute.attr});
     evaluator->evaluate_get(attribute.value);
   }
   void DelEvaluator::evaluate(const asdl::Subscript &subscript) const {
@@ -4,20 +4,33 @@
 #include "virtual_machine/evaluator.hpp"
 
 #include "asdl/asdl.hpp"
+#include "container/nursery.hpp"
+#include "object/method_cache.hpp"
 #include "virtual_machine/del_evaluator.hpp"
 #include "virtual_machine/get_evaluator.hpp"
 #include "virtual_machine/set_evaluator.hpp"
+#include "virtual_machine/step_profile.hpp"
 
 #include <gsl/gsl>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <exception>
 #include <istream>
 #include <ranges>
+#include <type_traits>
 
 using namespace std::literals;
 
 namespace chimera::library::virtual_machine {
+  //! name on the class of object or the first class of its __mro__
+  static auto class_lookup(const object::Object &object,
+                           const object::Symbol &name)
+      -> std::optional<object::Object> {
+    static const object::Symbol classSymbol("__class__");
+    return object::lookup_method(object.get_attribute(classSymbol), name);
+  }
   void destroy_object(object::Object &leftover) noexcept {
     std::vector<object::Object> todo = {leftover};
     while (!todo.empty()) {
@@ -40,6 +53,9 @@ namespace chimera::library::virtual_machine {
   [[nodiscard]] auto ReRaise::what() const noexcept -> const char * {
     return "ReRaise";
   }
+  void ReRaiseCurrent::operator()(Evaluator * /*evaluator*/) const {
+    throw ReRaise{};
+  }
   Scopes::operator bool() const { return !scopes.empty(); }
   [[nodiscard]] auto Scopes::self() -> object::Object & {
     if (scopes.empty()) {
@@ -68,9 +84,33 @@ namespace chimera::library::virtual_machine {
     if (!scopes.empty()) {
       scopes.pop();
     }
+    // temporaries of the scope are usually gone by now
+    container::nursery_reset();
+  }
+  [[nodiscard]] auto Scopes::local(std::uint32_t slot) const
+      -> std::optional<object::Object> {
+    if (scopes.empty() || slot >= scopes.top().locals.size()) {
+      return {};
+    }
+    return scopes.top().locals[slot];
+  }
+  void Scopes::local(std::uint32_t slot, const object::Object &value) {
+    if (scopes.empty()) {
+      enter_scope({});
+    }
+    auto &locals = scopes.top().locals;
+    if (slot >= locals.size()) {
+      locals.resize(slot + 1);
+    }
+    locals[slot] = value;
+  }
+  void Scopes::splice(const std::vector<Step> &steps) {
+    auto &top = scopes.top().bodies.top().steps;
+    top.insert(top.end(), steps.begin(), steps.end());
   }
   Evaluator::Evaluator(ThreadContext &thread_context) noexcept
-      : thread_context(thread_context) {}
+      : thread_context(thread_context),
+        replay_loops(thread_context->replay_loops()) {}
   Evaluator::~Evaluator() noexcept {
     for (; !stack.empty(); stack.pop()) {
       destroy_object(stack.top());
@@ -96,14 +136,102 @@ namespace chimera::library::virtual_machine {
         instructions | std::views::reverse,
         [this](const auto &instruction) { evaluate(instruction); });
   }
+  //! statements that do work while expanding instead of in a step
+  template <typename Stmt>
+  [[nodiscard]] static auto replayable(const Stmt & /*stmt*/) -> bool {
+    return true;
+  }
+  [[nodiscard]] static auto replayable(const asdl::Delete & /*asdlDelete*/)
+      -> bool {
+    return false;
+  }
+  [[nodiscard]] static auto
+  replayable(const asdl::FunctionDef & /*functionDef*/) -> bool {
+    return false;
+  }
+  [[nodiscard]] static auto replayable(const asdl::Return &asdlReturn)
+      -> bool {
+    return asdlReturn.value.has_value();
+  }
+  [[nodiscard]] static auto replayable(const asdl::Try & /*asdlTry*/)
+      -> bool {
+    return false;
+  }
+  void Evaluator::extend_loop(const std::vector<asdl::StmtImpl> &body,
+                              asdl::Hotness &hotness) {
+    if (!replay_loops || !hotness.run()) {
+      return extend(body);
+    }
+    if (auto found = loops.find(&body); found != loops.end()) {
+      return scope.splice(found->second);
+    }
+    if (!std::ranges::all_of(body, [](const auto &stmt) {
+          auto result = true;
+          stmt.visit([&result](const auto &value) {
+            result = replayable(value);
+          });
+          return result;
+        })) {
+      hotness.disable();
+      return extend(body);
+    }
+    auto steps = scope.record([this, &body] { extend(body); });
+    scope.splice(loops.emplace(&body, std::move(steps)).first->second);
+  }
   void Evaluator::extend(const std::vector<asdl::ExprImpl> &instructions) {
     std::ranges::for_each(
         instructions | std::views::reverse,
         [this](const auto &instruction) { evaluate_get(instruction); });
   }
+  [[nodiscard]] auto Evaluator::import_object(const std::string &module)
+      -> object::Object {
+    return thread_context->import_object("module_name"sv,
+                                         std::string_view{module});
+  }
   [[nodiscard]] auto Evaluator::return_value() const -> object::Object {
     return thread_context->return_value();
   }
+  void Evaluator::load(const asdl::Name &name) {
+    switch (name.binding.kind) {
+      case asdl::Binding::LOCAL:
+        if (auto value = scope.local(name.binding.slot)) {
+          return stack_push(*value);
+        }
+        throw object::BaseException(
+            builtins().get_attribute("UnboundLocalError"));
+      case asdl::Binding::GLOBAL:
+        if (auto found =
+                thread_context->body().find_attribute(name.value, name.cache)) {
+          return stack_push(*found);
+        }
+        if (auto found = builtins().find_attribute(name.value, name.builtin)) {
+          return stack_push(*found);
+        }
+        throw object::BaseException(builtins().get_attribute("NameError"));
+      case asdl::Binding::UNRESOLVED:
+      case asdl::Binding::FREE:
+        break;
+    }
+    // class bodies and cells of enclosing functions still go through the
+    // attribute protocol of the scope object
+    get_attribute(self(), name);
+  }
+  void Evaluator::store(const asdl::Name &name, const object::Object &value) {
+    switch (name.binding.kind) {
+      case asdl::Binding::LOCAL:
+        return scope.local(name.binding.slot, value);
+      case asdl::Binding::GLOBAL:
+        return thread_context->body().set_attribute(name.value, value,
+                                                    name.cache);
+      case asdl::Binding::UNRESOLVED:
+      case asdl::Binding::FREE:
+        break;
+    }
+    self().set_attribute(name.value, value, name.cache);
+  }
+  void Evaluator::return_value(object::Object &&value) {
+    thread_context->return_value(std::move(value));
+  }
   void Evaluator::stack_pop() { stack.pop(); }
   void Evaluator::stack_push(const object::Object &object) {
     stack.push(object);
@@ -138,24 +266,56 @@ namespace chimera::library::virtual_machine {
   }
   void Evaluator::get_attribute(const object::Object &object,
                                 const std::string &name) {
-    const std::string getAttribute("__getattribute__");
+    object::InlineCache cache;
+    get_attribute(object, name, cache);
+  }
+  void Evaluator::get_attribute(const object::Object &object,
+                                const asdl::Name &name) {
+    get_attribute(object, name.value, name.cache);
+  }
+  void Evaluator::get_attribute(const object::Object &object,
+                                const std::string &name,
+                                object::InlineCache &cache) {
+    static const object::Symbol getAttribute("__getattribute__");
     if (object.has_attribute(getAttribute)) {
-      return get_attribute(object, object.get_attribute(getAttribute), name);
+      return get_attribute(object, object.get_attribute(getAttribute), name,
+                           cache);
     }
-    auto mro = object.get_attribute("__class__").get_attribute("__mro__");
-    if (const auto tuple = mro.get<object::Tuple>()) {
-      for (const auto &type : *tuple) {
-        if (type.has_attribute(getAttribute)) {
-          return get_attribute(object, type.get_attribute(getAttribute), name);
-        }
-      }
+    if (auto method = class_lookup(object, getAttribute)) {
+      return get_attribute(object, *method, name, cache);
     }
     throw object::BaseException(builtins().get_attribute("AttributeError"));
   }
+  //! position of Type among the alternatives of Variant
+  template <typename Type, typename Variant>
+  struct AlternativeIndex;
+  template <typename Type, typename... Alternatives>
+  struct AlternativeIndex<Type, std::variant<Alternatives...>> {
+    static constexpr std::size_t value = [] {
+      constexpr std::array<bool, sizeof...(Alternatives)> same{
+          std::is_same_v<Type, Alternatives>...};
+      return static_cast<std::size_t>(std::ranges::find(same, true) -
+                                      same.begin());
+    }();
+  };
   void Evaluator::evaluate() {
     try {
       while (scope) {
         thread_context->process_interrupts();
+        object::process_released();
+        if (profile::enabled()) {
+          scope.visit([this](auto &&value) {
+            using Clock = std::chrono::steady_clock;
+            static constexpr auto step =
+                AlternativeIndex<std::remove_cvref_t<decltype(value)>,
+                                 Step>::value;
+            auto start = Clock::now();
+            auto finally = gsl::finally(
+                [start] { profile::record(step, Clock::now() - start); });
+            value(this);
+          });
+          continue;
+        }
         //! where all defered work gets done
         scope.visit([this](auto &&value) { value(this); });
       }
@@ -180,9 +340,7 @@ namespace chimera::library::virtual_machine {
   }
   void Evaluator::evaluate(const asdl::Expression &expression) {
     enter_scope(thread_context->body());
-    push([](Evaluator *evaluator) {
-      evaluator->thread_context->return_value(evaluator->stack_remove());
-    });
+    push(SetReturnValue{});
     evaluate_get(expression.expr());
     return evaluate();
   }
@@ -190,10 +348,7 @@ namespace chimera::library::virtual_machine {
     std::ranges::for_each(
         functionDef.decorator_list | std::views::reverse,
         [this](const auto &expr) {
-          push([](Evaluator *evaluator) {
-            auto decorator = evaluator->stack_remove();
-            evaluator->push(CallEvaluator{decorator, {evaluator->stack_top()}});
-          });
+          push(Decorate{});
           evaluate_get(expr);
         });
     if (functionDef.returns) {
@@ -219,12 +374,9 @@ namespace chimera::library::virtual_machine {
     if (functionDef.args.kwarg) {
     }
     if (functionDef.doc_string) {
-      push([&functionDef](Evaluator *evaluator) {
-        auto top = evaluator->stack_top();
-        top.set_attribute("__doc__"s, functionDef.doc_string->string);
-      });
+      push(SetDocString{functionDef});
     }
-    push(PushStack{object::Object(
+    const object::Object function(
         {{"__doc__", builtins().get_attribute("None")},
          {"__name__",
           object::Object(object::String(functionDef.name.value), {})},
@@ -236,7 +388,10 @@ namespace chimera::library::virtual_machine {
          {"__globals__", thread_context->body()},
          {"__closure__", self()},
          {"__annotations__", {}},
-         {"__kwdefaults__", {}}})});
+         {"__kwdefaults__", {}}});
+    // __globals__ and __closure__ usually lead back to the function
+    thread_context->track(function);
+    push(PushStack{function});
   }
   void
   Evaluator::evaluate(const asdl::AsyncFunctionDef & /*async_function_def*/) {}
@@ -252,65 +407,41 @@ namespace chimera::library::virtual_machine {
   }
   void Evaluator::evaluate(const asdl::AugAssign & /*aug_assign*/) {}
   void Evaluator::evaluate(const asdl::AnnAssign & /*ann_assign*/) {}
-  void Evaluator::evaluate(const asdl::For &asdlFor) {
-    push([&asdlFor](Evaluator *evaluatorA) {
-      try {
-        Evaluator evaluatorB{evaluatorA->thread_context};
-        evaluatorB.enter_scope(evaluatorA->self());
-        evaluatorB.push([](Evaluator *evaluatorC) {
-          evaluatorC->push(CallEvaluator{evaluatorC->stack_remove()});
-        });
-        evaluatorB.get_attribute(evaluatorA->stack_top(), "__next__");
-        evaluatorB.evaluate();
-      } catch (const object::BaseException &error) {
-        if (error.class_id() ==
-            evaluatorA->builtins().get_attribute("StopIteration").id()) {
-          evaluatorA->exit();
-          evaluatorA->extend(asdlFor.orelse);
-        } else {
-          throw error;
-        }
+  ForNext::ForNext(const asdl::For &asdlFor) noexcept : asdlFor(&asdlFor) {}
+  void ForNext::operator()(Evaluator *evaluatorA) const {
+    try {
+      Evaluator evaluatorB{evaluatorA->thread_context};
+      evaluatorB.enter_scope(evaluatorA->self());
+      evaluatorB.push(CallTop{});
+      evaluatorB.get_attribute(evaluatorA->stack_top(), "__next__");
+      evaluatorB.evaluate();
+    } catch (const object::BaseException &error) {
+      if (error.class_id() ==
+          evaluatorA->builtins().get_attribute("StopIteration").id()) {
+        evaluatorA->exit();
+        evaluatorA->extend(asdlFor->orelse);
+      } else {
+        throw error;
       }
-      evaluatorA->enter();
-      evaluatorA->push([&asdlFor](Evaluator *evaluatorB) {
-        evaluatorB->exit();
-        evaluatorB->evaluate(asdlFor);
-      });
-      evaluatorA->extend(asdlFor.body);
-      evaluatorA->evaluate_set(asdlFor.target);
-    });
-    push([](Evaluator *evaluatorA) {
-      evaluatorA->push(CallEvaluator{evaluatorA->stack_remove()});
-    });
-    push([](Evaluator *evaluatorA) {
-      evaluatorA->get_attribute(evaluatorA->stack_top(), "__iter__");
-      evaluatorA->stack_pop();
-    });
+    }
+    evaluatorA->enter();
+    evaluatorA->push(ForRepeat{*asdlFor});
+    evaluatorA->extend_loop(asdlFor->body, asdlFor->hotness);
+    evaluatorA->evaluate_set(asdlFor->target);
+  }
+  void Evaluator::evaluate(const asdl::For &asdlFor) {
+    push(ForNext{asdlFor});
+    push(CallTop{});
+    push(LoadMethod{"__iter__"sv});
     evaluate_get(asdlFor.iter);
-    push([](Evaluator *evaluatorA) { evaluatorA->enter(); });
+    push(EnterBody{});
   }
   void Evaluator::evaluate(const asdl::AsyncFor & /*async_for*/) {}
   void Evaluator::evaluate(const asdl::While &asdlWhile) {
-    push([&asdlWhile](Evaluator *evaluatorA) {
-      if (evaluatorA->stack_top().get_bool()) {
-        evaluatorA->enter();
-        evaluatorA->push([&asdlWhile](Evaluator *evaluatorB) {
-          evaluatorB->exit();
-          evaluatorB->evaluate(asdlWhile);
-        });
-        evaluatorA->extend(asdlWhile.body);
-      } else {
-        evaluatorA->exit();
-        evaluatorA->extend(asdlWhile.orelse);
-      }
-      evaluatorA->stack_pop();
-    });
-    push([](Evaluator *evaluatorA) {
-      evaluatorA->push(ToBoolEvaluator{evaluatorA->stack_top()});
-      evaluatorA->stack_pop();
-    });
+    push(WhileTest{asdlWhile});
+    push(ToBoolPop{});
     evaluate_get(asdlWhile.test);
-    push([](Evaluator *evaluatorA) { evaluatorA->enter(); });
+    push(EnterBody{});
   }
   void Evaluator::evaluate(const asdl::If & /*asdlIf*/) {
     // push([&asdlIf](Evaluator *evaluator) {
@@ -327,15 +458,17 @@ namespace chimera::library::virtual_machine {
     // });
     // evaluate_get(asdlIf.test);
   }
-  void Evaluator::evaluate(const asdl::With &with) {
-    push([&with](Evaluator *evaluator) {
-      if (auto exception1 = evaluator->do_try(with.body, {}); exception1) {
-        if (auto exception2 = evaluator->do_try(with.body, exception1);
-            exception2) {
-          throw object::BaseException(*exception2);
-        }
+  WithBody::WithBody(const asdl::With &with) noexcept : with(&with) {}
+  void WithBody::operator()(Evaluator *evaluator) const {
+    if (auto exception1 = evaluator->do_try(with->body, {}); exception1) {
+      if (auto exception2 = evaluator->do_try(with->body, exception1);
+          exception2) {
+        throw object::BaseException(*exception2);
       }
-    });
+    }
+  }
+  void Evaluator::evaluate(const asdl::With &with) {
+    push(WithBody{with});
     std::ranges::for_each(
         with.items | std::views::reverse,
         [this](const auto &withItem) { evaluate_get(withItem.context_expr); });
@@ -344,47 +477,16 @@ namespace chimera::library::virtual_machine {
   void Evaluator::evaluate(const asdl::Import &import) {
     std::ranges::for_each(
         import.names | std::views::reverse, [this](const auto &alias) {
-          if (alias.asname) {
-            push([&alias](Evaluator *evaluator) {
-              evaluator->self().set_attribute(alias.asname->value,
-                                              evaluator->stack_remove());
-              evaluator->stack_pop();
-            });
-          } else {
-            push([&alias](Evaluator *evaluator) {
-              evaluator->self().set_attribute(alias.name.value,
-                                              evaluator->stack_remove());
-              evaluator->stack_pop();
-            });
-          }
-          push([&alias](Evaluator *evaluator) {
-            evaluator->push(PushStack{evaluator->thread_context->import_object(
-                "module_name"sv, alias.name.value)});
-          });
+          push(StoreImport{alias});
+          push(ImportModule{alias.name.value});
         });
   }
   void Evaluator::evaluate(const asdl::ImportFrom &importFrom) {
-    push([](Evaluator *evaluator) { evaluator->stack_pop(); });
+    push(PopStack{});
     std::ranges::for_each(
-        importFrom.names | std::views::reverse, [this](const auto &alias) {
-          if (alias.asname) {
-            push([&alias](Evaluator *evaluator) {
-              evaluator->self().set_attribute(
-                  alias.asname->value,
-                  evaluator->stack_top().get_attribute(alias.name.value));
-            });
-          } else {
-            push([&alias](Evaluator *evaluator) {
-              evaluator->self().set_attribute(
-                  alias.name.value,
-                  evaluator->stack_top().get_attribute(alias.name.value));
-            });
-          }
-        });
-    push([&importFrom](Evaluator *evaluator) {
-      evaluator->push(PushStack{evaluator->thread_context->import_object(
-          "module_name"sv, importFrom.module.value)});
-    });
+        importFrom.names | std::views::reverse,
+        [this](const auto &alias) { push(StoreImportFrom{alias}); });
+    push(ImportModule{importFrom.module.value});
   }
   void Evaluator::evaluate(const asdl::Global & /*global*/) {}
   void Evaluator::evaluate(const asdl::Nonlocal & /*nonlocal*/) {}
@@ -392,28 +494,18 @@ namespace chimera::library::virtual_machine {
   void Evaluator::evaluate(const asdl::Raise &raise) {
     if (raise.exc) {
       if (raise.cause) {
-        push([](Evaluator *evaluator) {
-          const auto cause = object::BaseException(evaluator->stack_remove());
-          const auto exception = object::BaseException(evaluator->stack_top());
-          throw object::BaseException(exception, cause);
-        });
+        push(RaiseFrom{});
         evaluate_get(*raise.cause);
       } else {
-        push([](Evaluator *evaluator) {
-          throw object::BaseException(evaluator->stack_top());
-        });
+        push(Raise{});
       }
       evaluate_get(*raise.exc);
     } else {
-      push([](Evaluator * /*evaluator*/) { throw ReRaise{}; });
+      push(ReRaiseCurrent{});
     }
   }
   void Evaluator::evaluate(const asdl::Try &asdlTry) {
-    push([](Evaluator *evaluator) {
-      if (evaluator->thread_context->return_value().get_bool()) {
-        evaluator->exit_scope();
-      }
-    });
+    push(TryExit{});
     if (auto exception = do_try(asdlTry.body, {}); exception) {
       std::ranges::for_each(
           asdlTry.handlers | std::views::reverse,
@@ -433,43 +525,23 @@ namespace chimera::library::virtual_machine {
   }
   void Evaluator::evaluate(const asdl::Assert &assert) {
     if (builtins().get_attribute("__debug__").get_bool()) {
-      push([&assert](Evaluator *evaluatorA) {
-        if (!evaluatorA->stack_top().get_bool()) {
-          return evaluatorA->stack_pop();
-        }
-        evaluatorA->stack_pop();
-        if (!assert.msg) {
-          throw object::BaseException(
-              evaluatorA->builtins().get_attribute("AssertionError"));
-        }
-        evaluatorA->push([](Evaluator *evaluatorB) {
-          throw object::BaseException(
-              evaluatorB->builtins().get_attribute("AssertionError"));
-        });
-        evaluatorA->evaluate_get(*assert.msg);
-      });
+      push(AssertTest{assert});
       evaluate_get(assert.test);
     }
   }
   void Evaluator::evaluate(const asdl::Return &asdlReturn) {
     if (asdlReturn.value) {
-      push([](Evaluator *evaluator) {
-        evaluator->thread_context->return_value(evaluator->stack_remove());
-        evaluator->exit_scope();
-      });
+      push(ReturnTop{});
       evaluate_get(*asdlReturn.value);
     } else {
       exit_scope();
     }
   }
   void Evaluator::evaluate(const asdl::Break & /*break*/) {
-    push([](Evaluator *evaluator) {
-      evaluator->exit();
-      evaluator->exit();
-    });
+    push(BreakBody{});
   }
   void Evaluator::evaluate(const asdl::Continue & /*continue*/) {
-    push([](Evaluator *evaluator) { evaluator->exit(); });
+    push(ContinueBody{});
   }
   [[nodiscard]] auto
   Evaluator::do_try(const std::vector<asdl::StmtImpl> &body,
@@ -502,20 +574,16 @@ namespace chimera::library::virtual_machine {
   }
   void Evaluator::get_attribute(const object::Object &object,
                                 const object::Object &getAttribute,
-                                const std::string &name) {
+                                const std::string &name,
+                                object::InlineCache &cache) {
     if (getAttribute.get<object::ObjectMethod>() ==
         object::ObjectMethod::GETATTRIBUTE) {
       if (getAttribute.get_attribute("__class__").id() == 0 /* method */) {
-        if (object.has_attribute(name)) {
-          return push(PushStack{object.get_attribute(name)});
+        if (auto found = object.find_attribute(name, cache)) {
+          return push(PushStack{*std::move(found)});
         }
-        auto mro = object.get_attribute("__class__").get_attribute("__mro__");
-        if (const auto tuple = mro.get<object::Tuple>()) {
-          for (const auto &type : *tuple) {
-            if (type.has_attribute(name)) {
-              return push(PushStack{type.get_attribute(name)});
-            }
-          }
+        if (auto method = class_lookup(object, object::Symbol(name))) {
+          return push(PushStack{*std::move(method)});
         }
         return get_attr(object, name);
       }
@@ -527,23 +595,15 @@ namespace chimera::library::virtual_machine {
   }
   void Evaluator::get_attr(const object::Object &object,
                            const std::string &name) {
-    push([name](Evaluator *evaluator) {
-      evaluator->push(CallEvaluator{
-          evaluator->stack_remove(),
-          {object::Object(
-              object::String(name),
-              {{"__class__", evaluator->builtins().get_attribute("str")}})}});
-    });
-    if (object.has_attribute("__getattr__")) {
-      return push(PushStack{object.get_attribute("__getattr__")});
-    }
-    auto mro = object.get_attribute("__class__").get_attribute("__mro__");
-    if (const auto tuple = mro.get<object::Tuple>()) {
-      for (const auto &type : *tuple) {
-        if (type.has_attribute("__getattr__")) {
-          return push(PushStack{type.get_attribute("__getattr__")});
-        }
-      }
+    push(CallTopWith{object::Object(
+        object::String(name),
+        {{"__class__", builtins().get_attribute("str")}})});
+    static const object::Symbol getAttr("__getattr__");
+    if (object.has_attribute(getAttr)) {
+      return push(PushStack{object.get_attribute(getAttr)});
+    }
+    if (auto method = class_lookup(object, getAttr)) {
+      return push(PushStack{*std::move(method)});
     }
     throw object::BaseException(builtins().get_attribute("AttributeError"));
   }
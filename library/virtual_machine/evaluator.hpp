@@ -6,18 +6,37 @@
 #include "virtual_machine/bin_evaluator.hpp"
 #include "virtual_machine/bool_evaluator.hpp"
 #include "virtual_machine/call_evaluator.hpp"
+#include "virtual_machine/instructions.hpp"
 #include "virtual_machine/push_stack.hpp"
 #include "virtual_machine/thread_context.hpp"
 #include "virtual_machine/to_bool_evaluator.hpp"
 #include "virtual_machine/tuple_evaluator.hpp"
 #include "virtual_machine/unary_evaluator.hpp"
 
-#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <stack>
+#include <unordered_map>
 #include <variant>
+#include <vector>
 
 namespace chimera::library::virtual_machine {
   struct Evaluator;
+  //! every step is stored inline and dispatched through the variant
+  //! index, nothing on the hot path allocates a closure
+  using Step = std::variant<
+      BinEvaluator, BinIntTop, BinNumberTop, BoolAndEvaluator, BoolOrEvaluator,
+      CallEvaluator, PushStack, ToBoolEvaluator, TupleEvaluator,
+      UnaryBitNotEvaluator, UnaryNotEvaluator, UnaryAddEvaluator,
+      UnarySubEvaluator, AssertFail, AssertTest, BreakBody, CallTop,
+      CallTopWith, ContinueBody, Decorate, DelAttributeTop, EnterBody,
+      EnterScopeTop, ForNext, ForRepeat, GetAttributeTop, GetName, IfExpBranch,
+      ImportModule, LoadMethod, NotTop, PopStack, PushReturnValue, Raise,
+      RaiseFrom, ReRaiseCurrent, ReturnTop, SetAttributeTop, SetDocString,
+      SetName, SetReturnValue, StoreImport, StoreImportFrom, ToBoolPop,
+      ToBoolRemove, ToBoolTop, TryExit, UnpackCallObject, WhileRepeat,
+      WhileTest, WithBody>;
   struct Scopes {
     explicit operator bool() const;
     [[nodiscard]] auto self() -> object::Object &;
@@ -25,11 +44,26 @@ namespace chimera::library::virtual_machine {
     void enter();
     void exit();
     void exit_scope();
+    //! value of a frame slot of the current scope, empty until stored
+    [[nodiscard]] auto local(std::uint32_t slot) const
+        -> std::optional<object::Object>;
+    void local(std::uint32_t slot, const object::Object &value);
     template <typename Instruction>
     void push(Instruction &&instruction) {
-      scopes.top().bodies.top().steps.push(
+      scopes.top().bodies.top().steps.emplace_back(
           std::forward<Instruction>(instruction));
     }
+    //! the steps expand pushes, in a new body that is left again
+    template <typename Expand>
+    [[nodiscard]] auto record(Expand &&expand) -> std::vector<Step> {
+      enter();
+      std::forward<Expand>(expand)();
+      auto steps = std::move(scopes.top().bodies.top().steps);
+      exit();
+      return steps;
+    }
+    //! pushes steps taken from record in the order they were recorded
+    void splice(const std::vector<Step> &steps);
     template <typename Visitor>
     void visit(Visitor &&visitor) {
       if (scopes.empty()) {
@@ -43,8 +77,8 @@ namespace chimera::library::virtual_machine {
         exit();
         return;
       }
-      auto top = std::move(scopes.top().bodies.top().steps.top());
-      scopes.top().bodies.top().steps.pop();
+      auto top = std::move(scopes.top().bodies.top().steps.back());
+      scopes.top().bodies.top().steps.pop_back();
       std::visit(std::forward<Visitor>(visitor), std::move(top));
     }
 
@@ -52,20 +86,14 @@ namespace chimera::library::virtual_machine {
     struct Scope {
       object::Object self;
       struct Body {
-        using Step = std::variant<
-            BinAddEvaluator, BinSubEvaluator, BinMultEvaluator,
-            BinMatMultEvaluator, BinDivEvaluator, BinModEvaluator,
-            BinPowEvaluator, BinLShiftEvaluator, BinRShiftEvaluator,
-            BinBitOrEvaluator, BinBitXorEvaluator, BinBitAndEvaluator,
-            BinFloorDivEvaluator, BoolAndEvaluator, BoolOrEvaluator,
-            CallEvaluator, PushStack, ToBoolEvaluator, TupleEvaluator,
-            UnaryBitNotEvaluator, UnaryNotEvaluator, UnaryAddEvaluator,
-            UnarySubEvaluator, std::function<void(Evaluator *)>>;
-        std::stack<Step> steps{};
+        //! used as a stack, the next step is at the back
+        std::vector<Step> steps{};
       };
-      std::stack<Body> bodies{};
+      std::stack<Body, std::vector<Body>> bodies{};
+      //! indexed by asdl::Binding::slot, grows on first store
+      std::vector<std::optional<object::Object>> locals{};
     };
-    std::stack<Scope> scopes{};
+    std::stack<Scope, std::vector<Scope>> scopes{};
   };
   struct Evaluator {
     explicit Evaluator(ThreadContext &thread_context) noexcept;
@@ -81,12 +109,23 @@ namespace chimera::library::virtual_machine {
     void exit();
     void extend(const std::vector<asdl::ExprImpl> &instructions);
     void extend(const std::vector<asdl::StmtImpl> &instructions);
+    //! extend for the body of a loop, with -X replay_loops a body that
+    //! ran often enough replays the steps of an earlier expansion
+    void extend_loop(const std::vector<asdl::StmtImpl> &body,
+                     asdl::Hotness &hotness);
     void get_attribute(const object::Object &object, const std::string &name);
+    void get_attribute(const object::Object &object, const asdl::Name &name);
     template <typename Instruction>
     void push(Instruction &&instruction) {
       scope.push(std::forward<Instruction>(instruction));
     }
+    [[nodiscard]] auto import_object(const std::string &module)
+        -> object::Object;
+    //! pushes the value of a variable resolved by asdl::resolve
+    void load(const asdl::Name &name);
+    void store(const asdl::Name &name, const object::Object &value);
     [[nodiscard]] auto return_value() const -> object::Object;
+    void return_value(object::Object &&value);
     [[nodiscard]] auto self() -> object::Object &;
     void stack_pop();
     void stack_push(const object::Object &object);
@@ -129,16 +168,25 @@ namespace chimera::library::virtual_machine {
     void evaluate(const asdl::With &with);
 
   private:
+    friend ForNext;
+    friend WithBody;
     [[nodiscard]] auto
     do_try(const std::vector<asdl::StmtImpl> &body,
            const std::optional<object::BaseException> &context)
         -> std::optional<object::BaseException>;
     void get_attr(const object::Object &object, const std::string &name);
+    void get_attribute(const object::Object &object, const std::string &name,
+                       object::InlineCache &cache);
     void get_attribute(const object::Object &object,
                        const object::Object &getAttribute,
-                       const std::string &name);
+                       const std::string &name, object::InlineCache &cache);
     ThreadContext thread_context;
+    bool replay_loops;
+    //! steps recorded from hot loop bodies, they hold objects of this
+    //! process so they stay with the evaluator rather than the tree
+    std::unordered_map<const std::vector<asdl::StmtImpl> *, std::vector<Step>>
+        loops{};
     Scopes scope{};
-    std::stack<object::Object> stack{};
+    std::stack<object::Object, std::vector<object::Object>> stack{};
   };
 } // namespace chimera::library::virtual_machine
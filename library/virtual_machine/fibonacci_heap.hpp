@@ -4,110 +4,414 @@
 
 #include <gsl/gsl>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <iterator>
 #include <memory>
-#include <mutex>
+#include <utility>
+#include <vector>
 
 namespace chimera::library::virtual_machine {
   //! Fibonacci heap
   //! follows std::set/list for methods provided
+  //! emplace, merge, and decrease are amortized constant time, pop and erase
+  //! are amortized logarithmic, nodes come from a pool owned by the heap
   template <typename Key, typename Compare = std::less<Key>,
             typename Allocator = std::allocator<Key>>
   struct FibonacciHeap {
+  private:
+    struct Node;
+
+  public:
+    //! refers to one key until it is popped or erased
+    struct Handle {
+      [[nodiscard]] auto operator*() const -> const Key & { return node->key; }
+      [[nodiscard]] auto operator->() const -> const Key * {
+        return &node->key;
+      }
+
+    private:
+      friend FibonacciHeap;
+      explicit Handle(Node *node) noexcept : node(node) {}
+      Node *node;
+    };
     FibonacciHeap() noexcept = default;
-    template <typename... Args>
-    explicit FibonacciHeap(Args &&...args) {
-      Node node{std::forward<Args>(args)...};
-      min = &node;
-    }
     FibonacciHeap(const FibonacciHeap &fibonacciHeap) = delete;
-    FibonacciHeap(FibonacciHeap &&fibonacciHeap) noexcept = default;
-    ~FibonacciHeap() noexcept {
-      if (min != nullptr && min == min->get_left()) {
-        min->remove_left();
-        min = nullptr;
-      }
+    FibonacciHeap(FibonacciHeap &&fibonacciHeap) noexcept
+        : min(std::exchange(fibonacciHeap.min, nullptr)),
+          n(std::exchange(fibonacciHeap.n, 0)),
+          pool(std::move(fibonacciHeap.pool)) {}
+    ~FibonacciHeap() noexcept { clear(); }
+    auto operator=(const FibonacciHeap &fibonacciHeap)
+        -> FibonacciHeap & = delete;
+    auto operator=(FibonacciHeap &&fibonacciHeap) noexcept -> FibonacciHeap & {
+      FibonacciHeap(std::move(fibonacciHeap)).swap(*this);
+      return *this;
+    }
+    //! destroys every key, the pool keeps its memory for reuse
+    void clear() noexcept {
       if (min != nullptr) {
-        min->reset_left();
+        destroy_list(std::exchange(min, nullptr));
       }
+      n = 0;
     }
-    auto operator=(const FibonacciHeap &fibonacciHeap)
-        -> FibonacciHeap & = delete;
-    auto operator=(FibonacciHeap &&fibonacciHeap) noexcept
-        -> FibonacciHeap & = default;
-    template <typename Compare2>
-    void merge(FibonacciHeap<Key, Compare2, Allocator> &&source) {
-      if (min == nullptr) {
-        using std::swap;
-        swap(min, source.min);
-      } else if (source.min != nullptr) {
-        if (source.min < min) {
-          min = source.min;
-          source.min = nullptr;
-        }
+    //! lowers the key behind handle, key must not compare greater than the
+    //! current one
+    void decrease(Handle handle, Key key) {
+      auto *node = handle.node;
+      Expects(!compare(node->key, key));
+      node->key = std::move(key);
+      if (auto *parent = node->parent;
+          parent != nullptr && compare(node->key, parent->key)) {
+        cut(node);
+        cascading_cut(parent);
+      }
+      if (compare(node->key, min->key)) {
+        min = node;
       }
-      n += source.n;
-      source.n = 0;
     }
     template <typename... Args>
-    [[nodiscard]] auto emplace(Args &&...args) -> const Key & {
-      auto new_node = std::make_unique<Node>(Key{std::forward<Args>(args)...});
-      if (min == nullptr) {
-        min = (new_node->left = std::move(new_node)).get_left();
-        min->right = min;
-        ++n;
-        return min->key;
-      }
-      if (new_node < min) {
-        min = (new_node->left = std::move(new_node)).get_left();
-        min->right = min;
-        ++n;
-        return min->key;
-      }
-      new_node->left = std::move(min->left);
-      new_node->left->right = new_node.get();
-      new_node->right = min;
-      min->left = std::move(new_node);
+    auto emplace(Args &&...args) -> Handle {
+      auto *node = pool.create(std::forward<Args>(args)...);
+      meld(node);
+      if (compare(node->key, min->key)) {
+        min = node;
+      }
       ++n;
-      return min->key;
+      return Handle(node);
     }
+    [[nodiscard]] auto empty() const noexcept -> bool { return min == nullptr; }
+    void erase(Handle handle) noexcept {
+      auto *node = handle.node;
+      if (auto *parent = node->parent; parent != nullptr) {
+        cut(node);
+        cascading_cut(parent);
+      }
+      min = node;
+      pop();
+    }
+    //! visits every key, in no particular order
+    template <typename Visitor>
+    void for_each(Visitor &&visitor) const {
+      for (const auto *node : nodes()) {
+        visitor(std::as_const(node->key));
+      }
+    }
+    //! takes every node of source, which is left empty
+    void merge(FibonacciHeap &&source) {
+      if (source.min == nullptr) {
+        return;
+      }
+      pool.merge(std::move(source.pool));
+      auto *other = std::exchange(source.min, nullptr);
+      meld(other);
+      if (compare(other->key, min->key)) {
+        min = other;
+      }
+      n += std::exchange(source.n, 0);
+    }
+    //! removes the least key
+    void pop() noexcept {
+      Expects(min != nullptr);
+      auto *node = min;
+      if (node->child != nullptr) {
+        auto *child = std::exchange(node->child, nullptr);
+        auto *each = child;
+        do {
+          each->parent = nullptr;
+          each->mark = false;
+          each = each->right;
+        } while (each != child);
+        meld(child);
+      }
+      min = node->right == node ? nullptr : node->right;
+      unlink(node);
+      pool.destroy(node);
+      --n;
+      consolidate();
+    }
+    //! erases every key matching predicate, returns how many were erased
     template <typename Predicate>
-    void remove_if(Predicate && /*predicate*/) {}
+    auto remove_if(Predicate &&predicate) -> std::size_t {
+      std::size_t removed = 0;
+      for (auto *node : nodes()) {
+        if (!predicate(std::as_const(node->key))) {
+          continue;
+        }
+        if (auto *parent = node->parent; parent != nullptr) {
+          cut(node);
+          cascading_cut(parent);
+        }
+        if (node->child != nullptr) {
+          auto *child = std::exchange(node->child, nullptr);
+          auto *each = child;
+          do {
+            each->parent = nullptr;
+            each->mark = false;
+            each = each->right;
+          } while (each != child);
+          meld(child);
+        }
+        if (min == node) {
+          min = node->right == node ? nullptr : node->right;
+        }
+        unlink(node);
+        pool.destroy(node);
+        --n;
+        ++removed;
+      }
+      if (removed != 0) {
+        consolidate();
+      }
+      return removed;
+    }
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return n; }
+    void swap(FibonacciHeap &other) noexcept {
+      using std::swap;
+      swap(min, other.min);
+      swap(n, other.n);
+      pool.swap(other.pool);
+    }
+    [[nodiscard]] auto top() const -> const Key & {
+      Expects(min != nullptr);
+      return min->key;
+    }
 
   private:
     //! Internal node structure
     struct Node {
       template <typename... Args>
       explicit Node(Args &&...args) : key(std::forward<Args>(args)...) {}
-      Node(const Node &node) = delete;
-      Node(Node &&node) noexcept = default;
-      ~Node() noexcept {
-        if (child != nullptr) {
-          child->reset_left();
+      Key key;
+      std::uint64_t degree = 0;
+      bool mark = false;
+      Node *left = this;
+      Node *right = this;
+      Node *parent = nullptr;
+      Node *child = nullptr;
+    };
+    //! free list over blocks that grow geometrically, memory is only
+    //! returned when the pool is destroyed
+    struct Pool {
+      Pool() noexcept = default;
+      Pool(const Pool &pool) = delete;
+      Pool(Pool &&pool) noexcept
+          : blocks(std::move(pool.blocks)),
+            free(std::exchange(pool.free, nullptr)),
+            next(std::exchange(pool.next, nullptr)),
+            end(std::exchange(pool.end, nullptr)) {}
+      ~Pool() noexcept {
+        for (auto [block, count] : blocks) {
+          SlotTraits::deallocate(allocator, block, count);
         }
       }
-      auto operator=(const Node &node) -> Node & = delete;
-      auto operator=(Node &&node) noexcept -> Node & = default;
-      [[nodiscard]] auto operator<(const Node &node) -> bool;
-      [[nodiscard]] auto get_left() const -> const Node * { return left.get(); }
-      void remove_left() { std::ignore = std::move(left); }
-      void reset_left() {
-        if (left) {
-          auto ptr = std::move(left);
-          ptr.reset();
+      auto operator=(const Pool &pool) -> Pool & = delete;
+      auto operator=(Pool &&pool) noexcept -> Pool & = delete;
+      template <typename... Args>
+      [[nodiscard]] auto create(Args &&...args) -> Node * {
+        auto *slot = take();
+        try {
+          return std::construct_at(&slot->node, std::forward<Args>(args)...);
+        } catch (...) {
+          slot->next = std::exchange(free, slot);
+          throw;
         }
       }
+      void destroy(Node *node) noexcept {
+        std::destroy_at(node);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto *slot = reinterpret_cast<Slot *>(node);
+        slot->next = std::exchange(free, slot);
+      }
+      //! adopts the blocks of other, the unused tail of its current block
+      //! is dropped rather than tracked
+      void merge(Pool &&other) {
+        blocks.insert(blocks.end(), other.blocks.begin(), other.blocks.end());
+        other.blocks.clear();
+        while (other.free != nullptr) {
+          auto *slot = std::exchange(other.free, other.free->next);
+          slot->next = std::exchange(free, slot);
+        }
+        other.next = other.end = nullptr;
+      }
+      void swap(Pool &other) noexcept {
+        using std::swap;
+        swap(blocks, other.blocks);
+        swap(free, other.free);
+        swap(next, other.next);
+        swap(end, other.end);
+      }
 
     private:
-      Key key;
-      std::uint64_t degree = 0;
-      bool mark = false;
-      std::unique_ptr<Node> left{};
-      Node *right = nullptr;
-      Node *parent = nullptr;
-      Node *child = nullptr;
+      union Slot {
+        Slot() noexcept {}
+        Slot(const Slot &slot) = delete;
+        Slot(Slot &&slot) = delete;
+        ~Slot() noexcept {}
+        auto operator=(const Slot &slot) -> Slot & = delete;
+        auto operator=(Slot &&slot) -> Slot & = delete;
+        Slot *next;
+        Node node;
+      };
+      using SlotAllocator = typename std::allocator_traits<
+          Allocator>::template rebind_alloc<Slot>;
+      using SlotTraits = std::allocator_traits<SlotAllocator>;
+      static constexpr std::size_t firstBlock = 16;
+      static constexpr std::size_t largestBlock = 4096;
+      [[nodiscard]] auto take() -> Slot * {
+        if (free != nullptr) {
+          return std::exchange(free, free->next);
+        }
+        if (next == end) {
+          auto count = blocks.empty()
+                           ? firstBlock
+                           : std::min(blocks.back().second * 2, largestBlock);
+          blocks.reserve(blocks.size() + 1);
+          next = SlotTraits::allocate(allocator, count);
+          end = std::next(next, static_cast<std::ptrdiff_t>(count));
+          blocks.emplace_back(next, count);
+        }
+        return std::exchange(next, std::next(next));
+      }
+      [[no_unique_address]] SlotAllocator allocator{};
+      std::vector<std::pair<Slot *, std::size_t>> blocks{};
+      Slot *free = nullptr;
+      Slot *next = nullptr;
+      Slot *end = nullptr;
     };
-    Node *min = nullptr; //! owned by its own left member
-    std::uint64_t n = 0;
+    //! frees a circular sibling list and everything below it
+    void destroy_list(Node *first) noexcept {
+      auto *node = first;
+      do {
+        auto *next = node->right;
+        if (node->child != nullptr) {
+          destroy_list(node->child);
+        }
+        pool.destroy(node);
+        node = next;
+      } while (node != first);
+    }
+    //! joins the circular list holding list into the root list, leaves min
+    //! for the caller to update
+    void meld(Node *list) noexcept {
+      if (min == nullptr) {
+        min = list;
+        return;
+      }
+      auto *last = list->left;
+      min->left->right = list;
+      list->left = min->left;
+      last->right = min;
+      min->left = last;
+    }
+    //! removes node from whichever sibling list holds it
+    static void unlink(Node *node) noexcept {
+      if (node->parent != nullptr) {
+        if (node->parent->child == node) {
+          node->parent->child = node->right == node ? nullptr : node->right;
+        }
+        --node->parent->degree;
+        node->parent = nullptr;
+      }
+      node->left->right = node->right;
+      node->right->left = node->left;
+      node->left = node->right = node;
+    }
+    //! moves node from its parent to the root list
+    void cut(Node *node) noexcept {
+      unlink(node);
+      node->mark = false;
+      meld(node);
+    }
+    //! a parent that loses a second child is cut as well
+    void cascading_cut(Node *node) noexcept {
+      while (node->parent != nullptr) {
+        if (!node->mark) {
+          node->mark = true;
+          return;
+        }
+        auto *parent = node->parent;
+        cut(node);
+        node = parent;
+      }
+    }
+    //! makes child the child of parent, child is a root
+    static void link(Node *child, Node *parent) noexcept {
+      unlink(child);
+      child->parent = parent;
+      child->mark = false;
+      if (parent->child == nullptr) {
+        parent->child = child;
+      } else {
+        auto *sibling = parent->child;
+        child->right = sibling;
+        child->left = sibling->left;
+        sibling->left->right = child;
+        sibling->left = child;
+      }
+      ++parent->degree;
+    }
+    //! joins roots of equal degree until every degree is unique, then finds
+    //! the new minimum
+    void consolidate() noexcept {
+      if (min == nullptr) {
+        return;
+      }
+      // degree is bounded by log base golden ratio of the size
+      std::array<Node *, 96> degrees{};
+      auto *root = min;
+      auto *last = min->left;
+      auto done = false;
+      while (!done) {
+        done = root == last;
+        auto *node = std::exchange(root, root->right);
+        while (auto *other = degrees.at(node->degree)) {
+          degrees.at(node->degree) = nullptr;
+          if (compare(other->key, node->key)) {
+            std::swap(node, other);
+          }
+          if (min == other) {
+            min = node;
+          }
+          link(other, node);
+        }
+        degrees.at(node->degree) = node;
+      }
+      for (auto *node : degrees) {
+        if (node != nullptr && compare(node->key, min->key)) {
+          min = node;
+        }
+      }
+    }
+    //! snapshot of every node, parents before their children
+    [[nodiscard]] auto nodes() const -> std::vector<Node *> {
+      std::vector<Node *> all;
+      all.reserve(n);
+      if (min == nullptr) {
+        return all;
+      }
+      auto *node = min;
+      do {
+        all.push_back(node);
+        node = node->right;
+      } while (node != min);
+      for (std::size_t index = 0; index < all.size(); ++index) {
+        if (auto *child = all[index]->child; child != nullptr) {
+          auto *each = child;
+          do {
+            all.push_back(each);
+            each = each->right;
+          } while (each != child);
+        }
+      }
+      return all;
+    }
+    Node *min = nullptr;
+    std::size_t n = 0;
+    [[no_unique_address]] Compare compare{};
+    Pool pool{};
   };
 } // namespace chimera::library::virtual_machine
@@ -2,31 +2,225 @@
 
 #include "virtual_machine/garbage.hpp"
 
-#include <atomic>
-#include <mutex>
-#include <thread>
+#include "container/epoch.hpp"
+#include "object/object.hpp"
+
+#include <gsl/gsl>
+
+#include <chrono>             // for steady_clock, milliseconds
+#include <condition_variable> // for condition_variable
+#include <cstddef>            // for size_t
+#include <mutex>              // for lock_guard, unique_lock
+#include <thread>             // for thread
+#include <unordered_map>      // for unordered_map
+#include <unordered_set>      // for unordered_set
+#include <utility>            // for move
+#include <vector>             // for vector
+
+using namespace std::literals;
 
 namespace chimera::library::virtual_machine {
-  GarbageCollector::GarbageCollector() : thread([this] { this->collect(); }) {}
+  //! how often the collector thread looks for newly tracked objects
+  static constexpr auto pollInterval = 100ms;
+  //! cycles can form long after tracking, so collect at least this often
+  static constexpr auto collectInterval = 1s;
+  //! one object in the trial deletion subgraph
+  struct Vertex {
+    //! the only reference the collector holds outside the tracked heap
+    object::Object object;
+    //! entries for this object in the tracked heap
+    std::size_t holds = 0;
+    std::vector<std::size_t> edges{};
+    //! references from outside the subgraph, nonzero keeps the vertex alive
+    long external = 0;
+    bool alive = false;
+  };
+  struct Graph {
+    std::vector<Vertex> vertices{};
+    std::unordered_map<const void *, std::size_t> index{};
+    auto add(const object::Object &object) -> std::size_t {
+      auto [found, inserted] =
+          index.try_emplace(object.address(), vertices.size());
+      if (inserted) {
+        vertices.push_back({.object = object});
+      }
+      return found->second;
+    }
+  };
+  //! every object reachable from roots, these are never candidates
+  static auto mark(std::vector<object::Object> &&work)
+      -> std::unordered_set<const void *> {
+    std::unordered_set<const void *> marked;
+    while (!work.empty()) {
+      auto object = std::move(work.back());
+      work.pop_back();
+      if (marked.insert(object.address()).second) {
+        object.referents(
+            [&work](const object::Object &referent) { work.push_back(referent); });
+      }
+    }
+    return marked;
+  }
+  //! recounts references for members, an edge is only recorded when both ends
+  //! are members
+  static void count(Graph &graph, const std::vector<std::size_t> &members,
+                    const std::vector<bool> &member) {
+    for (auto vertex : members) {
+      auto &each = graph.vertices[vertex];
+      each.edges.clear();
+      each.external = each.object.use_count() - 1 -
+                      static_cast<long>(each.holds);
+      each.object.referents([&graph, &each, &member](const auto &referent) {
+        if (auto found = graph.index.find(referent.address());
+            found != graph.index.end() && member[found->second]) {
+          each.edges.push_back(found->second);
+        }
+      });
+    }
+    for (auto vertex : members) {
+      for (auto edge : graph.vertices[vertex].edges) {
+        --graph.vertices[edge].external;
+      }
+    }
+  }
+  //! anything reachable from a vertex referenced from outside stays alive
+  template <typename Predicate>
+  static void propagate(Graph &graph, const std::vector<std::size_t> &members,
+                        Predicate &&seed) {
+    std::vector<std::size_t> work;
+    for (auto vertex : members) {
+      graph.vertices[vertex].alive = false;
+      if (seed(graph.vertices[vertex])) {
+        work.push_back(vertex);
+      }
+    }
+    while (!work.empty()) {
+      auto &vertex = graph.vertices[work.back()];
+      work.pop_back();
+      if (vertex.alive) {
+        continue;
+      }
+      vertex.alive = true;
+      work.insert(work.end(), vertex.edges.begin(), vertex.edges.end());
+    }
+  }
+  GarbageCollector::GarbageCollector(Roots roots)
+      : roots(std::move(roots)), thread([this] { this->run(); }) {}
   GarbageCollector::~GarbageCollector() noexcept {
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    wake.notify_all();
     if (thread.joinable()) {
-      flag.clear();
       thread.join();
     }
   }
-  void GarbageCollector::collect() {
-    flag.test_and_set();
-    FibonacciHeap<object::Object, Compare> garbage{};
-    while (flag.test_and_set()) {
-      garbage.remove_if([](auto &&node) { return node.use_count() <= 1; });
-      FibonacciHeap<object::Object, Compare> moving{};
+  auto GarbageCollector::collect() -> std::size_t {
+    const std::lock_guard<std::mutex> lock(collecting);
+    {
+      Heap moving{};
       {
-        const std::lock_guard<std::mutex> lock(mutex);
-        using std::swap;
-        swap(moving, fibonacciHeap);
+        const std::lock_guard<std::mutex> guard(mutex);
+        moving.swap(pending);
+      }
+      tracked.merge(std::move(moving));
+    }
+    // nothing else refers to these, dropping them here keeps the cascade of
+    // destructors off the evaluator threads
+    auto released = tracked.remove_if(
+        [](const auto &object) { return object.use_count() <= 1; });
+    if (!tracked.empty()) {
+      released += collect_cycles();
+    }
+    container::reclaim();
+    return released;
+  }
+  //! trial deletion over the tracked objects that roots do not reach,
+  //! candidates are marked suspect so any evaluator access while they are
+  //! recounted vetoes freeing them
+  auto GarbageCollector::collect_cycles() -> std::size_t {
+    const auto marked = mark(roots());
+    Graph graph;
+    tracked.for_each([&graph, &marked](const auto &object) {
+      if (!marked.contains(object.address())) {
+        ++graph.vertices[graph.add(object)].holds;
+      }
+    });
+    for (std::size_t vertex = 0; vertex < graph.vertices.size(); ++vertex) {
+      std::vector<object::Object> referents;
+      graph.vertices[vertex].object.referents(
+          [&referents, &marked](const auto &referent) {
+            if (!marked.contains(referent.address())) {
+              referents.push_back(referent);
+            }
+          });
+      for (const auto &referent : referents) {
+        graph.add(referent);
+      }
+    }
+    std::vector<std::size_t> members(graph.vertices.size());
+    std::vector<bool> member(graph.vertices.size(), true);
+    for (std::size_t vertex = 0; vertex < members.size(); ++vertex) {
+      members[vertex] = vertex;
+    }
+    count(graph, members, member);
+    propagate(graph, members,
+              [](const auto &vertex) { return vertex.external != 0; });
+    std::vector<std::size_t> candidates;
+    for (auto vertex : members) {
+      member[vertex] = !graph.vertices[vertex].alive;
+      if (member[vertex]) {
+        candidates.push_back(vertex);
+      }
+    }
+    if (candidates.empty()) {
+      return 0;
+    }
+    for (auto vertex : candidates) {
+      graph.vertices[vertex].object.suspect();
+    }
+    // references taken before the suspect mark was visible are counted below
+    container::synchronize();
+    count(graph, candidates, member);
+    // accesses racing the recount have set the touched mark by now
+    container::synchronize();
+    propagate(graph, candidates, [](const auto &vertex) {
+      return vertex.external != 0 || vertex.object.touched();
+    });
+    std::unordered_set<const void *> garbage;
+    for (auto vertex : candidates) {
+      auto &each = graph.vertices[vertex];
+      if (!each.alive) {
+        garbage.insert(each.object.address());
+        each.object.clear_attributes();
+      }
+      each.object.absolve();
+    }
+    tracked.remove_if([&garbage](const auto &object) {
+      return garbage.contains(object.address());
+    });
+    return garbage.size();
+  }
+  void GarbageCollector::track(const object::Object &object) {
+    // the collector thread drops tracked objects
+    object.share();
+    const std::lock_guard<std::mutex> lock(mutex);
+    pending.emplace(object);
+  }
+  void GarbageCollector::run() {
+    auto last = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop) {
+      wake.wait_for(lock, pollInterval);
+      auto now = std::chrono::steady_clock::now();
+      if (stop || (pending.empty() && now - last < collectInterval)) {
+        continue;
       }
-      garbage.merge(std::move(moving));
-      std::this_thread::yield();
+      lock.unlock();
+      collect();
+      last = now;
+      lock.lock();
     }
   }
 } // namespace chimera::library::virtual_machine
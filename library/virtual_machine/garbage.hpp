@@ -7,36 +7,58 @@
 
 #include <gsl/gsl>
 
-#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace chimera::library::virtual_machine {
+  //! concurrent cycle collector, objects that may end up in a reference cycle
+  //! are tracked and a background thread frees the ones only kept alive by
+  //! each other, evaluator threads are never stopped
   struct GarbageCollector {
-    GarbageCollector();
+    //! objects that are always reachable, evaluator stacks are accounted for
+    //! by reference counts instead
+    using Roots = std::function<std::vector<object::Object>()>;
+    explicit GarbageCollector(Roots roots);
     GarbageCollector(const GarbageCollector &collector) = delete;
     GarbageCollector(GarbageCollector &&collector) = delete;
     ~GarbageCollector() noexcept;
     auto operator=(const GarbageCollector &collector)
         -> GarbageCollector & = delete;
     auto operator=(GarbageCollector &&collector) -> GarbageCollector & = delete;
-    template <typename... Args>
-    [[nodiscard]] auto emplace(Args &&...args) {
-      const std::lock_guard<std::mutex> lock(mutex);
-      return fibonacciHeap.emplace(std::forward<Args>(args)...);
-    }
+    //! runs a full collection on the calling thread, returns how many tracked
+    //! objects were released
+    auto collect() -> std::size_t;
+    //! hand an object to the collector
+    void track(const object::Object &object);
 
   private:
-    void collect();
+    //! the heap only serves as a bag that merges in constant time, nothing
+    //! takes its minimum so every object compares equal
     struct Compare {
-      [[nodiscard]] auto operator()(const object::Object &left,
-                                    const object::Object &right) -> bool {
-        return left.id() < right.id();
+      [[nodiscard]] auto operator()(const object::Object & /*left*/,
+                                    const object::Object & /*right*/) const
+          noexcept -> bool {
+        return false;
       }
     };
-    std::atomic_flag flag = ATOMIC_FLAG_INIT;
-    std::thread thread;
+    using Heap = FibonacciHeap<object::Object, Compare>;
+    [[nodiscard]] auto collect_cycles() -> std::size_t;
+    void run();
+    Roots roots;
+    //! serializes collections so tests can collect beside the thread
+    std::mutex collecting{};
+    //! only touched while collecting is held
+    Heap tracked{};
     std::mutex mutex{};
-    FibonacciHeap<object::Object, Compare> fibonacciHeap{};
+    std::condition_variable wake{};
+    //! guarded by mutex
+    Heap pending{};
+    //! guarded by mutex
+    bool stop = false;
+    std::thread thread;
   };
 } // namespace chimera::library::virtual_machine
@@ -17,53 +17,11 @@ namespace chimera::library::virtual_machine {
         evaluator->push(BoolOrEvaluator{asdlBool.values});
         break;
     }
-    evaluator->push([](Evaluator *evaluatorA) {
-      evaluatorA->push(ToBoolEvaluator{evaluatorA->stack_top()});
-    });
+    evaluator->push(ToBoolTop{});
     evaluator->evaluate_get(asdlBool.values.front());
   }
   void GetEvaluator::evaluate(const asdl::Bin &bin) const {
-    switch (bin.op) {
-      case asdl::Operator::ADD:
-        evaluator->push(BinAddEvaluator{bin.values});
-        break;
-      case asdl::Operator::SUB:
-        evaluator->push(BinSubEvaluator{bin.values});
-        break;
-      case asdl::Operator::MULT:
-        evaluator->push(BinMultEvaluator{bin.values});
-        break;
-      case asdl::Operator::MAT_MULT:
-        evaluator->push(BinMatMultEvaluator{bin.values});
-        break;
-      case asdl::Operator::DIV:
-        evaluator->push(BinDivEvaluator{bin.values});
-        break;
-      case asdl::Operator::MOD:
-        evaluator->push(BinModEvaluator{bin.values});
-        break;
-      case asdl::Operator::POW:
-        evaluator->push(BinPowEvaluator{bin.values});
-        break;
-      case asdl::Operator::L_SHIFT:
-        evaluator->push(BinLShiftEvaluator{bin.values});
-        break;
-      case asdl::Operator::R_SHIFT:
-        evaluator->push(BinRShiftEvaluator{bin.values});
-        break;
-      case asdl::Operator::BIT_OR:
-        evaluator->push(BinBitOrEvaluator{bin.values});
-        break;
-      case asdl::Operator::BIT_XOR:
-        evaluator->push(BinBitXorEvaluator{bin.values});
-        break;
-      case asdl::Operator::BIT_AND:
-        evaluator->push(BinBitAndEvaluator{bin.values});
-        break;
-      case asdl::Operator::FLOOR_DIV:
-        evaluator->push(BinFloorDivEvaluator{bin.values});
-        break;
-    }
+    evaluator->push(BinEvaluator{bin});
     evaluator->evaluate_get(bin.values.front());
   }
   void GetEvaluator::evaluate(const asdl::Unary &unary) const {
@@ -87,15 +45,8 @@ namespace chimera::library::virtual_machine {
     evaluator->push(PushStack{evaluator->builtins().get_attribute("None")});
   }
   void GetEvaluator::evaluate(const asdl::IfExp &ifExp) const {
-    evaluator->push([&ifExp](Evaluator *evaluatorA) {
-      evaluatorA->evaluate_get(
-          evaluatorA->stack_top().get_bool() ? ifExp.body : ifExp.orelse);
-      evaluatorA->stack_pop();
-    });
-    evaluator->push([](Evaluator *evaluatorA) {
-      evaluatorA->push(ToBoolEvaluator{evaluatorA->stack_top()});
-      evaluatorA->stack_pop();
-    });
+    evaluator->push(IfExpBranch{ifExp});
+    evaluator->push(ToBoolPop{});
     evaluator->evaluate_get(ifExp.test);
   }
   void GetEvaluator::evaluate(const asdl::ListComp & /*list_comp*/) const {
@@ -125,21 +76,13 @@ namespace chimera::library::virtual_machine {
     evaluator->push(PushStack{evaluator->builtins().get_attribute("None")});
   }
   void GetEvaluator::evaluate(const asdl::Call &call) const {
-    evaluator->push([](Evaluator *evaluatorA) {
-      evaluatorA->push(PushStack{evaluatorA->return_value()});
-    });
+    evaluator->push(PushReturnValue{});
     evaluator->extend(call.args);
-    evaluator->push([](Evaluator *evaluatorA) {
-      auto top = evaluatorA->stack_remove();
-      evaluatorA->enter_scope(top);
-    });
+    evaluator->push(EnterScopeTop{});
     evaluator->evaluate_get(call.func);
   }
   void GetEvaluator::evaluate(const asdl::Attribute &attribute) const {
-    evaluator->push([&attribute](Evaluator *evaluatorA) {
-      evaluatorA->get_attribute(evaluatorA->stack_top(), attribute.attr.value);
-      evaluatorA->stack_pop();
-    });
+    evaluator->push(GetAttributeTop{attribute.attr});
     evaluator->evaluate_get(attribute.value);
   }
   void GetEvaluator::evaluate(const asdl::Subscript &subscript) const {
@@ -173,7 +116,7 @@ namespace chimera::library::virtual_machine {
     evaluator->push(PushStack{evaluator->builtins().get_attribute("None")});
   }
   void GetEvaluator::evaluate(const asdl::Name &name) const {
-    evaluator->get_attribute(evaluator->self(), name.value);
+    evaluator->push(GetName{name});
   }
   void GetEvaluator::evaluate(const asdl::Dict & /*dict*/) const {
     evaluator->push(PushStack{evaluator->builtins().get_attribute("dict")});
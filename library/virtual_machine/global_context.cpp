@@ -27,9 +27,15 @@ namespace chimera::library::virtual_machine {
     SIG_INT.test_and_set();
     std::ignore = std::signal(SIGINT, interupt_handler);
   }
+  [[nodiscard]] auto GlobalContextImpl::replay_loops() const -> bool {
+    return options.replay_loops;
+  }
   [[nodiscard]] auto GlobalContextImpl::debug() const -> bool {
     return options.debug;
   }
+  [[nodiscard]] auto GlobalContextImpl::dont_write_byte_code() const -> bool {
+    return options.dont_write_byte_code;
+  }
   [[nodiscard]] auto GlobalContextImpl::interactive() -> int {
     if (!options.dont_display_copyright) {
       std::cout << "chimera " << CHIMERA_VERSION
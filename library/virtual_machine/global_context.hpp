@@ -10,7 +10,9 @@
 namespace chimera::library::virtual_machine {
   struct GlobalContextImpl : std::enable_shared_from_this<GlobalContextImpl> {
     explicit GlobalContextImpl(Options options);
+    [[nodiscard]] auto replay_loops() const -> bool;
     [[nodiscard]] auto debug() const -> bool;
+    [[nodiscard]] auto dont_write_byte_code() const -> bool;
     [[nodiscard]] auto interactive() -> int;
     [[nodiscard]] auto execute_script() -> int;
     [[nodiscard]] auto execute_script_string() -> int;
@@ -0,0 +1,188 @@
+//! the small steps pushed between the larger evaluators, each one is a plain
+//! value in Step instead of a type erased closure
+
+#include "virtual_machine/instructions.hpp"
+
+#include "asdl/asdl.hpp"
+#include "virtual_machine/evaluator.hpp"
+
+#include <string> // for string
+
+using namespace std::literals;
+
+namespace chimera::library::virtual_machine {
+  void CallTop::operator()(Evaluator *evaluator) const {
+    evaluator->push(CallEvaluator{evaluator->stack_remove()});
+  }
+  CallTopWith::CallTopWith(object::Object argument)
+      : argument(std::move(argument)) {}
+  void CallTopWith::operator()(Evaluator *evaluator) const {
+    evaluator->push(CallEvaluator{evaluator->stack_remove(), {argument}});
+  }
+  LoadMethod::LoadMethod(std::string_view name) noexcept : name(name) {}
+  void LoadMethod::operator()(Evaluator *evaluator) const {
+    evaluator->get_attribute(evaluator->stack_top(), std::string(name));
+    evaluator->stack_pop();
+  }
+  GetAttributeTop::GetAttributeTop(const asdl::Name &name) noexcept
+      : name(&name) {}
+  void GetAttributeTop::operator()(Evaluator *evaluator) const {
+    evaluator->get_attribute(evaluator->stack_top(), *name);
+    evaluator->stack_pop();
+  }
+  GetName::GetName(const asdl::Name &name) noexcept : name(&name) {}
+  void GetName::operator()(Evaluator *evaluator) const {
+    evaluator->load(*name);
+  }
+  DelAttributeTop::DelAttributeTop(const asdl::Name &name) noexcept
+      : name(&name) {}
+  void DelAttributeTop::operator()(Evaluator *evaluator) const {
+    auto top = evaluator->stack_top();
+    top.delete_attribute(name->value);
+    evaluator->stack_pop();
+  }
+  SetAttributeTop::SetAttributeTop(const asdl::Name &name) noexcept
+      : name(&name) {}
+  void SetAttributeTop::operator()(Evaluator *evaluator) const {
+    auto object = evaluator->stack_remove();
+    auto top = evaluator->stack_top();
+    top.set_attribute(name->value, std::move(object), name->cache);
+    evaluator->stack_pop();
+  }
+  SetName::SetName(const asdl::Name &name) noexcept : name(&name) {}
+  void SetName::operator()(Evaluator *evaluator) const {
+    evaluator->store(*name, evaluator->stack_top());
+  }
+  void PopStack::operator()(Evaluator *evaluator) const {
+    evaluator->stack_pop();
+  }
+  void ToBoolTop::operator()(Evaluator *evaluator) const {
+    evaluator->push(ToBoolEvaluator{evaluator->stack_top()});
+  }
+  void ToBoolPop::operator()(Evaluator *evaluator) const {
+    evaluator->push(ToBoolEvaluator{evaluator->stack_top()});
+    evaluator->stack_pop();
+  }
+  void ToBoolRemove::operator()(Evaluator *evaluator) const {
+    evaluator->push(ToBoolEvaluator{evaluator->stack_remove()});
+  }
+  void NotTop::operator()(Evaluator *evaluator) const {
+    if (evaluator->stack_top().get_bool()) {
+      evaluator->stack_top_update(evaluator->builtins().get_attribute("False"));
+    } else {
+      evaluator->stack_top_update(evaluator->builtins().get_attribute("True"));
+    }
+  }
+  IfExpBranch::IfExpBranch(const asdl::IfExp &ifExp) noexcept
+      : ifExp(&ifExp) {}
+  void IfExpBranch::operator()(Evaluator *evaluator) const {
+    evaluator->evaluate_get(evaluator->stack_top().get_bool() ? ifExp->body
+                                                              : ifExp->orelse);
+    evaluator->stack_pop();
+  }
+  void EnterScopeTop::operator()(Evaluator *evaluator) const {
+    auto top = evaluator->stack_remove();
+    evaluator->enter_scope(top);
+  }
+  void PushReturnValue::operator()(Evaluator *evaluator) const {
+    evaluator->push(PushStack{evaluator->return_value()});
+  }
+  void EnterBody::operator()(Evaluator *evaluator) const { evaluator->enter(); }
+  void ContinueBody::operator()(Evaluator *evaluator) const {
+    evaluator->exit();
+  }
+  void BreakBody::operator()(Evaluator *evaluator) const {
+    evaluator->exit();
+    evaluator->exit();
+  }
+  void Decorate::operator()(Evaluator *evaluator) const {
+    auto decorator = evaluator->stack_remove();
+    evaluator->push(CallEvaluator{decorator, {evaluator->stack_top()}});
+  }
+  SetDocString::SetDocString(const asdl::FunctionDef &functionDef) noexcept
+      : functionDef(&functionDef) {}
+  void SetDocString::operator()(Evaluator *evaluator) const {
+    auto top = evaluator->stack_top();
+    top.set_attribute("__doc__"s, functionDef->doc_string->string);
+  }
+  ForRepeat::ForRepeat(const asdl::For &asdlFor) noexcept : asdlFor(&asdlFor) {}
+  void ForRepeat::operator()(Evaluator *evaluator) const {
+    evaluator->exit();
+    evaluator->evaluate(*asdlFor);
+  }
+  WhileTest::WhileTest(const asdl::While &asdlWhile) noexcept
+      : asdlWhile(&asdlWhile) {}
+  void WhileTest::operator()(Evaluator *evaluator) const {
+    if (evaluator->stack_top().get_bool()) {
+      evaluator->enter();
+      evaluator->push(WhileRepeat{*asdlWhile});
+      evaluator->extend_loop(asdlWhile->body, asdlWhile->hotness);
+    } else {
+      evaluator->exit();
+      evaluator->extend(asdlWhile->orelse);
+    }
+    evaluator->stack_pop();
+  }
+  WhileRepeat::WhileRepeat(const asdl::While &asdlWhile) noexcept
+      : asdlWhile(&asdlWhile) {}
+  void WhileRepeat::operator()(Evaluator *evaluator) const {
+    evaluator->exit();
+    evaluator->evaluate(*asdlWhile);
+  }
+  ImportModule::ImportModule(const std::string &module) noexcept
+      : module(&module) {}
+  void ImportModule::operator()(Evaluator *evaluator) const {
+    evaluator->push(PushStack{evaluator->import_object(*module)});
+  }
+  StoreImport::StoreImport(const asdl::Alias &alias) noexcept
+      : alias(&alias) {}
+  void StoreImport::operator()(Evaluator *evaluator) const {
+    evaluator->store(alias->asname ? *alias->asname : alias->name,
+                     evaluator->stack_remove());
+    evaluator->stack_pop();
+  }
+  StoreImportFrom::StoreImportFrom(const asdl::Alias &alias) noexcept
+      : alias(&alias) {}
+  void StoreImportFrom::operator()(Evaluator *evaluator) const {
+    evaluator->store(alias->asname ? *alias->asname : alias->name,
+                     evaluator->stack_top().get_attribute(alias->name.value));
+  }
+  void Raise::operator()(Evaluator *evaluator) const {
+    throw object::BaseException(evaluator->stack_top());
+  }
+  void RaiseFrom::operator()(Evaluator *evaluator) const {
+    const auto cause = object::BaseException(evaluator->stack_remove());
+    const auto exception = object::BaseException(evaluator->stack_top());
+    throw object::BaseException(exception, cause);
+  }
+  void TryExit::operator()(Evaluator *evaluator) const {
+    if (evaluator->return_value().get_bool()) {
+      evaluator->exit_scope();
+    }
+  }
+  AssertTest::AssertTest(const asdl::Assert &assert) noexcept
+      : assert(&assert) {}
+  void AssertTest::operator()(Evaluator *evaluator) const {
+    if (!evaluator->stack_top().get_bool()) {
+      return evaluator->stack_pop();
+    }
+    evaluator->stack_pop();
+    if (!assert->msg) {
+      throw object::BaseException(
+          evaluator->builtins().get_attribute("AssertionError"));
+    }
+    evaluator->push(AssertFail{});
+    evaluator->evaluate_get(*assert->msg);
+  }
+  void AssertFail::operator()(Evaluator *evaluator) const {
+    throw object::BaseException(
+        evaluator->builtins().get_attribute("AssertionError"));
+  }
+  void SetReturnValue::operator()(Evaluator *evaluator) const {
+    evaluator->return_value(evaluator->stack_remove());
+  }
+  void ReturnTop::operator()(Evaluator *evaluator) const {
+    evaluator->return_value(evaluator->stack_remove());
+    evaluator->exit_scope();
+  }
+} // namespace chimera::library::virtual_machine
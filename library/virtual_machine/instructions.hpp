@@ -0,0 +1,243 @@
+//! the small steps pushed between the larger evaluators, each one is a plain
+//! value in Step instead of a type erased closure
+
+#pragma once
+
+#include "asdl/asdl.hpp"
+#include "object/object.hpp"
+
+#include <string_view>
+
+namespace chimera::library::virtual_machine {
+  struct Evaluator;
+  //! calls the object on top of the stack
+  struct CallTop {
+    static constexpr std::string_view profile_name = "CallTop";
+    void operator()(Evaluator *evaluator) const;
+  };
+  //! calls the object on top of the stack with one argument
+  struct CallTopWith {
+    static constexpr std::string_view profile_name = "CallTopWith";
+    explicit CallTopWith(object::Object argument);
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    object::Object argument;
+  };
+  //! replaces the top of the stack with a named attribute of it
+  struct LoadMethod {
+    static constexpr std::string_view profile_name = "LoadMethod";
+    explicit LoadMethod(std::string_view name) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    std::string_view name;
+  };
+  struct GetAttributeTop {
+    static constexpr std::string_view profile_name = "GetAttributeTop";
+    explicit GetAttributeTop(const asdl::Name &name) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::Name *name;
+  };
+  //! pushes the value of a variable from wherever asdl::resolve bound it
+  struct GetName {
+    static constexpr std::string_view profile_name = "GetName";
+    explicit GetName(const asdl::Name &name) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::Name *name;
+  };
+  struct DelAttributeTop {
+    static constexpr std::string_view profile_name = "DelAttributeTop";
+    explicit DelAttributeTop(const asdl::Name &name) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::Name *name;
+  };
+  struct SetAttributeTop {
+    static constexpr std::string_view profile_name = "SetAttributeTop";
+    explicit SetAttributeTop(const asdl::Name &name) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::Name *name;
+  };
+  struct SetName {
+    static constexpr std::string_view profile_name = "SetName";
+    explicit SetName(const asdl::Name &name) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::Name *name;
+  };
+  struct PopStack {
+    static constexpr std::string_view profile_name = "PopStack";
+    void operator()(Evaluator *evaluator) const;
+  };
+  //! converts the top of the stack and leaves it in place
+  struct ToBoolTop {
+    static constexpr std::string_view profile_name = "ToBoolTop";
+    void operator()(Evaluator *evaluator) const;
+  };
+  //! converts the top of the stack and pops it
+  struct ToBoolPop {
+    static constexpr std::string_view profile_name = "ToBoolPop";
+    void operator()(Evaluator *evaluator) const;
+  };
+  //! converts the result of __bool__ once it is called
+  struct ToBoolRemove {
+    static constexpr std::string_view profile_name = "ToBoolRemove";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct NotTop {
+    static constexpr std::string_view profile_name = "NotTop";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct IfExpBranch {
+    static constexpr std::string_view profile_name = "IfExpBranch";
+    explicit IfExpBranch(const asdl::IfExp &ifExp) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::IfExp *ifExp;
+  };
+  struct EnterScopeTop {
+    static constexpr std::string_view profile_name = "EnterScopeTop";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct PushReturnValue {
+    static constexpr std::string_view profile_name = "PushReturnValue";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct EnterBody {
+    static constexpr std::string_view profile_name = "EnterBody";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct ContinueBody {
+    static constexpr std::string_view profile_name = "ContinueBody";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct BreakBody {
+    static constexpr std::string_view profile_name = "BreakBody";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct Decorate {
+    static constexpr std::string_view profile_name = "Decorate";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct SetDocString {
+    static constexpr std::string_view profile_name = "SetDocString";
+    explicit SetDocString(const asdl::FunctionDef &functionDef) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::FunctionDef *functionDef;
+  };
+  struct ForNext {
+    static constexpr std::string_view profile_name = "ForNext";
+    explicit ForNext(const asdl::For &asdlFor) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::For *asdlFor;
+  };
+  struct ForRepeat {
+    static constexpr std::string_view profile_name = "ForRepeat";
+    explicit ForRepeat(const asdl::For &asdlFor) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::For *asdlFor;
+  };
+  struct WhileTest {
+    static constexpr std::string_view profile_name = "WhileTest";
+    explicit WhileTest(const asdl::While &asdlWhile) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::While *asdlWhile;
+  };
+  struct WhileRepeat {
+    static constexpr std::string_view profile_name = "WhileRepeat";
+    explicit WhileRepeat(const asdl::While &asdlWhile) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::While *asdlWhile;
+  };
+  struct WithBody {
+    static constexpr std::string_view profile_name = "WithBody";
+    explicit WithBody(const asdl::With &with) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::With *with;
+  };
+  struct ImportModule {
+    static constexpr std::string_view profile_name = "ImportModule";
+    explicit ImportModule(const std::string &module) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const std::string *module;
+  };
+  //! binds the module on top of the stack and pops it
+  struct StoreImport {
+    static constexpr std::string_view profile_name = "StoreImport";
+    explicit StoreImport(const asdl::Alias &alias) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::Alias *alias;
+  };
+  //! binds one name from the module on top of the stack
+  struct StoreImportFrom {
+    static constexpr std::string_view profile_name = "StoreImportFrom";
+    explicit StoreImportFrom(const asdl::Alias &alias) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::Alias *alias;
+  };
+  struct Raise {
+    static constexpr std::string_view profile_name = "Raise";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct RaiseFrom {
+    static constexpr std::string_view profile_name = "RaiseFrom";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct ReRaiseCurrent {
+    static constexpr std::string_view profile_name = "ReRaiseCurrent";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct TryExit {
+    static constexpr std::string_view profile_name = "TryExit";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct AssertTest {
+    static constexpr std::string_view profile_name = "AssertTest";
+    explicit AssertTest(const asdl::Assert &assert) noexcept;
+    void operator()(Evaluator *evaluator) const;
+
+  private:
+    const asdl::Assert *assert;
+  };
+  struct AssertFail {
+    static constexpr std::string_view profile_name = "AssertFail";
+    void operator()(Evaluator *evaluator) const;
+  };
+  //! stores the top of the stack as the thread return value
+  struct SetReturnValue {
+    static constexpr std::string_view profile_name = "SetReturnValue";
+    void operator()(Evaluator *evaluator) const;
+  };
+  struct ReturnTop {
+    static constexpr std::string_view profile_name = "ReturnTop";
+    void operator()(Evaluator *evaluator) const;
+  };
+} // namespace chimera::library::virtual_machine
@@ -8,19 +8,20 @@
 #include "marshal/marshal.hpp"
 #include "object/object.hpp"
 #include "sys/sys.hpp"
+#include "virtual_machine/code_cache.hpp"
 #include "virtual_machine/evaluator.hpp"
 #include "virtual_machine/thread_context.hpp"
 
-#include "number-rust.hpp"
-
 #include <gsl/gsl>
 
 #include <csignal>
 #include <exception>
-#include <fstream>
+#include <filesystem>
 #include <iostream>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <vector>
 
 using namespace std::literals;
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -49,7 +50,25 @@ namespace chimera::library::virtual_machine {
       : builtins_(std::map<std::string, object::Object>{}),
         global_context(global_context),
         modules(
-            std::map<std::string, object::Object>({{"builtins", builtins_}})) {
+            std::map<std::string, object::Object>({{"builtins", builtins_}})),
+        garbage_collector(std::make_shared<GarbageCollector>([this] {
+          std::vector<object::Object> roots{builtins_};
+          for (const auto &module : modules.read().value) {
+            roots.push_back(module.second);
+          }
+          return roots;
+        })) {
+    modules::builtins(builtins_);
+  }
+  //! the imported module itself is stored in the importer, so its objects
+  //! are reachable from the roots of the shared collector
+  ProcessContextImpl::ProcessContextImpl(GlobalContext &global_context,
+                                         const ProcessContextImpl &importer)
+      : builtins_(std::map<std::string, object::Object>{}),
+        global_context(global_context),
+        modules(
+            std::map<std::string, object::Object>({{"builtins", builtins_}})),
+        garbage_collector(importer.garbage_collector) {
     modules::builtins(builtins_);
   }
   ProcessContextImpl::~ProcessContextImpl() noexcept {
@@ -58,7 +77,6 @@ namespace chimera::library::virtual_machine {
     for (auto &module : modules.write().value) {
       destroy_module(module.second);
     }
-    r_vm_clear();
   }
   [[nodiscard]] auto ProcessContextImpl::builtins() const
       -> const object::Object & {
@@ -66,20 +84,19 @@ namespace chimera::library::virtual_machine {
   }
   [[nodiscard]] auto ProcessContextImpl::make_module(std::string_view &&name)
       -> object::Object {
-    auto result = modules.try_emplace(std::string(name));
-    if (result.second) {
-      modules::builtins(result.first->second);
-      result.first->second.set_attribute(
+    auto [module, inserted] = modules.try_emplace(std::string(name));
+    if (inserted) {
+      modules::builtins(module);
+      module.set_attribute(
           "__name__"s,
-          object::Object(
-              object::String(std::string(name)),
-              {{"__class__"s, result.first->second.get_attribute("str"s)}}));
+          object::Object(object::String(std::string(name)),
+                         {{"__class__"s, module.get_attribute("str"s)}}));
     }
-    return result.first->second;
+    return module;
   }
   [[nodiscard]] auto
   ProcessContextImpl::find_module(const std::string_view &module)
-      -> std::optional<std::ifstream> {
+      -> std::optional<std::string> {
     for (std::string_view::size_type
              pos = CHIMERA_IMPORT_PATH_VIEW.find_first_of(':'),
              prev = 0;
@@ -91,10 +108,10 @@ namespace chimera::library::virtual_machine {
         if (global_context->verbose_init() == options::VerboseInit::SEARCH) {
           std::cout << pathString << '\n';
         }
-        std::ifstream ifstream(pathString,
-                               std::iostream::in | std::iostream::binary);
-        if (ifstream.is_open() && ifstream.good()) {
-          return {std::move(ifstream)};
+        // regular files only, they are mapped rather than read
+        if (std::error_code error;
+            std::filesystem::is_regular_file(pathString, error)) {
+          return {std::move(pathString)};
         }
       } catch (const object::BaseException &) {
       }
@@ -103,10 +120,10 @@ namespace chimera::library::virtual_machine {
         if (global_context->verbose_init() == options::VerboseInit::SEARCH) {
           std::cout << pathString << '\n';
         }
-        std::ifstream ifstream(pathString,
-                               std::iostream::in | std::iostream::binary);
-        if (ifstream.is_open() && ifstream.good()) {
-          return {std::move(ifstream)};
+        // regular files only, they are mapped rather than read
+        if (std::error_code error;
+            std::filesystem::is_regular_file(pathString, error)) {
+          return {std::move(pathString)};
         }
       } catch (const object::BaseException &) {
       }
@@ -116,15 +133,15 @@ namespace chimera::library::virtual_machine {
   [[nodiscard]] auto ProcessContextImpl::import_module(std::string &&module)
       -> std::optional<asdl::Module> {
     std::replace(module.begin(), module.end(), '.', '/');
-    if (auto istream = find_module(module)) {
-      return asdl::Module(global_context->optimize(), *istream, module.c_str());
+    if (auto source = find_module(module)) {
+      return load_module(*source);
     }
     return {};
   }
   [[nodiscard]] auto
   ProcessContextImpl::import_object(std::string_view &&name,
                                     std::string_view &&relativeModule)
-      -> const object::Object & {
+      -> object::Object {
     if (relativeModule.empty() || relativeModule.at(0) != '.') {
       return import_object(std::string_view{relativeModule});
     }
@@ -143,41 +160,43 @@ namespace chimera::library::virtual_machine {
   }
   [[nodiscard]] auto
   ProcessContextImpl::import_object(std::string_view &&request_module)
-      -> const object::Object & {
-    if (!modules.contains(std::string(request_module))) {
-      std::vector<std::string_view> path{request_module};
-      path.reserve(
-          std::count(request_module.cbegin(), request_module.cend(), '.'));
-      for (auto index = path.back().find_last_of('.');
-           index != std::string_view::npos;
-           index = path[-1].find_last_of('.')) {
-        path.emplace_back(path.back().substr(0, index));
+      -> object::Object {
+    if (auto found = modules.find(std::string(request_module))) {
+      return *std::move(found);
+    }
+    std::vector<std::string_view> path{request_module};
+    path.reserve(
+        std::count(request_module.cbegin(), request_module.cend(), '.'));
+    for (auto index = path.back().find_last_of('.');
+         index != std::string_view::npos;
+         index = path[-1].find_last_of('.')) {
+      path.emplace_back(path.back().substr(0, index));
+    }
+    std::reverse(path.begin(), path.end());
+    for (auto &module : path) {
+      auto result = make_module(std::string_view{module});
+      auto index = module.find_last_of('.');
+      if (index < module.size()) {
+        modules.at(std::string(module.substr(0, index)))
+            .set_attribute(std::string(module.substr(index + 1)), result);
       }
-      std::reverse(path.begin(), path.end());
-      for (auto &module : path) {
-        auto result = make_module(std::string_view{module});
-        auto index = module.find_last_of('.');
-        if (index < module.size()) {
-          object::Object(modules.at(std::string(module.substr(0, index))))
-              .set_attribute(std::string(module.substr(index + 1)), result);
-        }
-        if (module == "builtin"sv) {
-          modules::builtins(result);
-        } else if (module == "importlib"sv) {
-          modules::importlib(result);
-        } else if (module == "marshal"sv) {
-          modules::marshal(result);
-        } else if (module == "sys"sv) {
-          modules::sys(result);
-          global_context->sys_argv(result);
-        } else if (auto istream = find_module(module)) {
-          auto process = make_process(global_context);
-          auto thread = make_thread(process, result);
-          Evaluator(thread).evaluate(parse_file(*istream, module.data()));
-        } else {
-          throw std::runtime_error(
-              "no module "s.append(module).append(" found"sv));
-        }
+      if (module == "builtin"sv) {
+        modules::builtins(result);
+      } else if (module == "importlib"sv) {
+        modules::importlib(result);
+      } else if (module == "marshal"sv) {
+        modules::marshal(result);
+      } else if (module == "sys"sv) {
+        modules::sys(result);
+        global_context->sys_argv(result);
+      } else if (auto source = find_module(module)) {
+        auto process =
+            std::make_shared<ProcessContextImpl>(global_context, *this);
+        auto thread = make_thread(process, result);
+        Evaluator(thread).evaluate(load_module(*source));
+      } else {
+        throw std::runtime_error(
+            "no module "s.append(module).append(" found"sv));
       }
     }
     return modules.at(std::string(request_module));
@@ -186,13 +205,24 @@ namespace chimera::library::virtual_machine {
   ProcessContextImpl::import_module(const std::string_view &path,
                                     const std::string &module) -> asdl::Module {
     auto source = std::string(path).append(module);
-    std::ifstream istream(source, std::iostream::in | std::iostream::binary);
-    Ensures(istream.is_open() && istream.good());
+    Ensures(std::filesystem::is_regular_file(source));
     if (global_context->verbose_init() == options::VerboseInit::LOAD) {
       std::cout << path << module << '\n';
     }
     std::cerr << path << module << '\n';
-    return parse_file(istream, source.c_str());
+    return parse_file(source.c_str());
+  }
+  [[nodiscard]] auto ProcessContextImpl::load_module(const std::string &source)
+      -> asdl::Module {
+    const CodeCache cache(source, global_context->optimize());
+    if (auto module = cache.load()) {
+      return *std::move(module);
+    }
+    auto module = parse_file(source.c_str());
+    if (!global_context->dont_write_byte_code()) {
+      cache.store(module);
+    }
+    return module;
   }
   [[nodiscard]] auto ProcessContextImpl::parse_expression(
       std::istream &input, const char *source) const -> asdl::Expression {
@@ -203,14 +233,24 @@ namespace chimera::library::virtual_machine {
       -> asdl::Module {
     return {global_context->optimize(), input, source};
   }
+  [[nodiscard]] auto ProcessContextImpl::parse_file(const char *source) const
+      -> asdl::Module {
+    return {global_context->optimize(), source};
+  }
   [[nodiscard]] auto ProcessContextImpl::parse_input(std::istream &input,
                                                      const char *source) const
       -> asdl::Interactive {
     return {global_context->optimize(), input, source};
   }
+  [[nodiscard]] auto ProcessContextImpl::replay_loops() const -> bool {
+    return global_context->replay_loops();
+  }
   void ProcessContextImpl::process_interrupts() const {
     global_context->process_interrupts();
   }
+  void ProcessContextImpl::track(const object::Object &object) {
+    garbage_collector->track(object);
+  }
   auto make_process(GlobalContext &global_context) -> ProcessContext {
     return std::make_shared<ProcessContextImpl>(global_context);
   }
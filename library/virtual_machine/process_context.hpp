@@ -9,6 +9,7 @@
 #include "virtual_machine/global_context.hpp"
 
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -16,6 +17,10 @@
 namespace chimera::library::virtual_machine {
   struct ProcessContextImpl {
     explicit ProcessContextImpl(GlobalContext &global_context);
+    //! evaluates a module imported by importer, whose collector tracks the
+    //! objects it creates
+    ProcessContextImpl(GlobalContext &global_context,
+                       const ProcessContextImpl &importer);
     ProcessContextImpl(const ProcessContextImpl &) = delete;
     ProcessContextImpl(ProcessContextImpl &&) noexcept = delete;
     ~ProcessContextImpl() noexcept;
@@ -25,7 +30,7 @@ namespace chimera::library::virtual_machine {
     [[nodiscard]] auto builtins() const -> const object::Object &;
     [[nodiscard]] auto import_object(std::string_view &&name,
                                      std::string_view &&relativeModule)
-        -> const object::Object &;
+        -> object::Object;
     [[nodiscard]] auto import_module(std::string &&module)
         -> std::optional<asdl::Module>;
     [[nodiscard]] auto make_module(std::string_view &&name) -> object::Object;
@@ -34,23 +39,31 @@ namespace chimera::library::virtual_machine {
         -> asdl::Expression;
     [[nodiscard]] auto parse_file(std::istream &input, const char *source) const
         -> asdl::Module;
+    //! maps a regular file instead of copying it through a stream
+    [[nodiscard]] auto parse_file(const char *source) const -> asdl::Module;
     [[nodiscard]] auto parse_input(std::istream &input,
                                    const char *source) const
         -> asdl::Interactive;
+    [[nodiscard]] auto replay_loops() const -> bool;
     void process_interrupts() const;
+    //! objects that can close a reference cycle are handed to the collector
+    void track(const object::Object &object);
 
   private:
     [[nodiscard]] auto find_module(const std::string_view &path)
-        -> std::optional<std::ifstream>;
+        -> std::optional<std::string>;
     [[nodiscard]] auto import_module(const std::string_view &path,
                                      const std::string &module) -> asdl::Module;
     [[nodiscard]] auto import_object(std::string_view &&request_module)
-        -> const object::Object &;
+        -> object::Object;
+    //! parses a source file unless __pycache__ holds a current copy
+    [[nodiscard]] auto load_module(const std::string &source) -> asdl::Module;
     object::Object builtins_;
     GlobalContext global_context;
-    // TODO(asakatida)
-    // GarbageCollector garbage_collector{};
     container::AtomicMap<std::string, object::Object> modules;
+    //! declared last so its thread is joined before the roots go away,
+    //! shared with the short lived processes that evaluate imports
+    std::shared_ptr<GarbageCollector> garbage_collector;
   };
   using ProcessContext = std::shared_ptr<ProcessContextImpl>;
   auto make_process(GlobalContext &global_context) -> ProcessContext;
@@ -11,21 +11,14 @@ namespace chimera::library::virtual_machine {
   SetEvaluator::SetEvaluator(Evaluator *evaluator) noexcept
       : evaluator(evaluator) {}
   void SetEvaluator::evaluate(const asdl::Attribute &attribute) const {
-    evaluator->push([&attribute](Evaluator *evaluatorA) {
-      auto object = evaluatorA->stack_remove();
-      auto top = evaluatorA->stack_top();
-      top.set_attribute(attribute.attr.value, std::move(object));
-      evaluatorA->stack_pop();
-    });
+    evaluator->push(SetAttributeTop{attribute.attr});
     evaluator->evaluate_get(attribute.value);
   }
   void SetEvaluator::evaluate(const asdl::Subscript &subscript) const {
     evaluator->evaluate_get(subscript.value);
   }
   void SetEvaluator::evaluate(const asdl::Name &name) const {
-    evaluator->push([&name](Evaluator *evaluatorA) {
-      evaluatorA->self().set_attribute(name.value, evaluatorA->stack_top());
-    });
+    evaluator->push(SetName{name});
   }
   void SetEvaluator::evaluate(const asdl::List & /*list*/) const {
     evaluator->push(PushStack{evaluator->builtins().get_attribute("None")});
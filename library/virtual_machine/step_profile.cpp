@@ -0,0 +1,82 @@
+//! dispatch counts and time spent per evaluator step, off unless enabled
+
+#include "virtual_machine/step_profile.hpp"
+
+#include "virtual_machine/evaluator.hpp"
+
+#include <algorithm> // for sort
+#include <array>     // for array
+#include <atomic>    // for atomic
+#include <utility>   // for index_sequence
+#include <variant>   // for variant_size_v
+
+namespace chimera::library::virtual_machine::profile {
+  template <std::size_t... Index>
+  [[nodiscard]] consteval auto
+  step_names(std::index_sequence<Index...> /*index*/)
+      -> std::array<std::string_view, sizeof...(Index)> {
+    return {std::variant_alternative_t<Index, Step>::profile_name...};
+  }
+  //! indexed like the alternatives of Step
+  static constexpr auto names =
+      step_names(std::make_index_sequence<std::variant_size_v<Step>>{});
+  struct Counter {
+    std::atomic<std::uint64_t> count{0};
+    std::atomic<std::uint64_t> nanoseconds{0};
+  };
+  static std::atomic<bool> profiling{false};
+  static std::array<Counter, names.size()> counters{};
+  //! indexed by Quickened
+  static std::array<std::atomic<std::uint64_t>, 3> quickened{};
+  void enable(bool on) noexcept {
+    profiling.store(on, std::memory_order_relaxed);
+  }
+  [[nodiscard]] auto enabled() noexcept -> bool {
+    return profiling.load(std::memory_order_relaxed);
+  }
+  void record(std::size_t step, std::chrono::nanoseconds time) noexcept {
+    auto &counter = counters.at(step);
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.nanoseconds.fetch_add(static_cast<std::uint64_t>(time.count()),
+                                  std::memory_order_relaxed);
+  }
+  void record(Quickened event) noexcept {
+    quickened.at(static_cast<std::size_t>(event))
+        .fetch_add(1, std::memory_order_relaxed);
+  }
+  void reset() noexcept {
+    for (auto &counter : counters) {
+      counter.count.store(0, std::memory_order_relaxed);
+      counter.nanoseconds.store(0, std::memory_order_relaxed);
+    }
+    for (auto &counter : quickened) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+  }
+  [[nodiscard]] auto steps() -> std::vector<StepTotal> {
+    std::vector<StepTotal> totals;
+    for (std::size_t step = 0; step < names.size(); ++step) {
+      if (auto count = counters.at(step).count.load(std::memory_order_relaxed);
+          count != 0) {
+        totals.push_back(
+            {.name = names.at(step),
+             .count = count,
+             .time = std::chrono::nanoseconds(
+                 counters.at(step).nanoseconds.load(std::memory_order_relaxed))});
+      }
+    }
+    std::ranges::sort(totals, [](const auto &left, const auto &right) {
+      return left.time > right.time;
+    });
+    return totals;
+  }
+  [[nodiscard]] auto quickening() noexcept -> QuickeningTotal {
+    auto load = [](Quickened event) {
+      return quickened.at(static_cast<std::size_t>(event))
+          .load(std::memory_order_relaxed);
+    };
+    return {.specialised = load(Quickened::SPECIALISED),
+            .hits = load(Quickened::HIT),
+            .misses = load(Quickened::MISS)};
+  }
+} // namespace chimera::library::virtual_machine::profile
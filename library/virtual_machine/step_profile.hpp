@@ -0,0 +1,35 @@
+//! dispatch counts and time spent per evaluator step, off unless enabled
+
+#pragma once
+
+#include <chrono>      // for nanoseconds
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t
+#include <string_view> // for string_view
+#include <vector>      // for vector
+
+namespace chimera::library::virtual_machine::profile {
+  struct StepTotal {
+    std::string_view name;
+    std::uint64_t count;
+    //! includes any evaluator the step runs to completion itself
+    std::chrono::nanoseconds time;
+  };
+  //! what specialised steps did, a miss sends the node back to generic
+  struct QuickeningTotal {
+    std::uint64_t specialised;
+    std::uint64_t hits;
+    std::uint64_t misses;
+  };
+  enum class Quickened : std::uint8_t { SPECIALISED, HIT, MISS };
+  //! every evaluator in the process counts while enabled
+  void enable(bool on) noexcept;
+  [[nodiscard]] auto enabled() noexcept -> bool;
+  //! step is the index of the alternative in Step
+  void record(std::size_t step, std::chrono::nanoseconds time) noexcept;
+  void record(Quickened event) noexcept;
+  void reset() noexcept;
+  //! totals of steps dispatched since the last reset, most time first
+  [[nodiscard]] auto steps() -> std::vector<StepTotal>;
+  [[nodiscard]] auto quickening() noexcept -> QuickeningTotal;
+} // namespace chimera::library::virtual_machine::profile
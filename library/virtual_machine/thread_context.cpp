@@ -15,6 +15,9 @@ namespace chimera::library::virtual_machine {
       -> const object::Object & {
     return process_context->builtins();
   }
+  [[nodiscard]] auto ThreadContextImpl::replay_loops() const -> bool {
+    return process_context->replay_loops();
+  }
   void ThreadContextImpl::process_interrupts() const {
     process_context->process_interrupts();
   }
@@ -24,6 +27,9 @@ namespace chimera::library::virtual_machine {
   void ThreadContextImpl::return_value(object::Object &&value) {
     ret = std::move(value);
   }
+  void ThreadContextImpl::track(const object::Object &object) {
+    process_context->track(object);
+  }
   auto make_thread(ProcessContext &process_context, object::Object main)
       -> ThreadContext {
     return std::make_shared<ThreadContextImpl>(process_context,
@@ -13,12 +13,8 @@ namespace chimera::library::virtual_machine {
     } else if (object.get<object::True>()) {
       evaluator->push(PushStack{evaluator->builtins().get_attribute("True")});
     } else {
-      evaluator->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(ToBoolEvaluator{evaluatorB->stack_remove()});
-      });
-      evaluator->push([](Evaluator *evaluatorB) {
-        evaluatorB->push(CallEvaluator{evaluatorB->stack_remove()});
-      });
+      evaluator->push(ToBoolRemove{});
+      evaluator->push(CallTop{});
       evaluator->get_attribute(object, "__bool__");
     }
   }
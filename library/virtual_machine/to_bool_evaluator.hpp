@@ -4,9 +4,12 @@
 
 #include "object/object.hpp"
 
+#include <string_view>
+
 namespace chimera::library::virtual_machine {
   struct Evaluator;
   struct ToBoolEvaluator {
+    static constexpr std::string_view profile_name = "ToBoolEvaluator";
     explicit ToBoolEvaluator(object::Object object);
     void operator()(Evaluator *evaluator) const;
 
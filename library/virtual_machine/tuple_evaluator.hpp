@@ -3,10 +3,12 @@
 #pragma once
 
 #include <cstddef>
+#include <string_view>
 
 namespace chimera::library::virtual_machine {
   struct Evaluator;
   struct TupleEvaluator {
+    static constexpr std::string_view profile_name = "TupleEvaluator";
     explicit TupleEvaluator(std::size_t size) noexcept;
     void operator()(Evaluator *evaluator) const;
 
@@ -5,20 +5,25 @@
 
 #include "asdl/asdl.hpp"
 
+#include <string_view>
 #include <vector>
 
 namespace chimera::library::virtual_machine {
   struct Evaluator;
   struct UnaryBitNotEvaluator {
+    static constexpr std::string_view profile_name = "UnaryBitNotEvaluator";
     void operator()(Evaluator *evaluator) const;
   };
   struct UnaryNotEvaluator {
+    static constexpr std::string_view profile_name = "UnaryNotEvaluator";
     void operator()(Evaluator *evaluator) const;
   };
   struct UnaryAddEvaluator {
+    static constexpr std::string_view profile_name = "UnaryAddEvaluator";
     void operator()(Evaluator *evaluator) const;
   };
   struct UnarySubEvaluator {
+    static constexpr std::string_view profile_name = "UnarySubEvaluator";
     void operator()(Evaluator *evaluator) const;
   };
 } // namespace chimera::library::virtual_machine
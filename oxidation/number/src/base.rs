@@ -231,7 +231,7 @@ impl Shl for Base {
     type Output = Number;
     #[inline]
     fn shl(self, other: Self) -> Self::Output {
-        (self.value << other.value).into()
+        Natural::from(self) << Natural::from(other)
     }
 }
 
@@ -239,7 +239,11 @@ impl Shr for Base {
     type Output = Number;
     #[inline]
     fn shr(self, other: Self) -> Self::Output {
-        (self.value >> other.value).into()
+        u32::try_from(other.value)
+            .ok()
+            .and_then(|shift| self.value.checked_shr(shift))
+            .unwrap_or_default()
+            .into()
     }
 }
 
@@ -0,0 +1,195 @@
+#![deny(clippy::pedantic)]
+#![deny(clippy::restriction)]
+#![allow(clippy::arithmetic_side_effects)]
+#![allow(clippy::blanket_clippy_restriction_lints)]
+#![allow(clippy::implicit_return)]
+#![allow(clippy::missing_docs_in_private_items)]
+
+//! Lock-free handle table for numbers shared with C++.
+//!
+//! Handles are slot indexes offset by one so that `0` stays free for moved
+//! from values on the C++ side.  Slots live in lazily allocated chunks that
+//! are never released, freed slots are recycled through a tagged Treiber
+//! stack and every slot carries its own atomic reference count.
+
+use core::cell::UnsafeCell;
+use core::sync::atomic::{fence, AtomicU32, AtomicU64, AtomicUsize, Ordering};
+use std::sync::OnceLock;
+
+use crate::number::Number;
+
+const CHUNK_BITS: u32 = 12;
+const CHUNK_SIZE: usize = 1 << CHUNK_BITS;
+const CHUNK_COUNT: usize = 1 << 14;
+const NIL: u32 = u32::MAX;
+
+#[derive(Debug, Default)]
+struct Slot {
+    refs: AtomicUsize,
+    next: AtomicU32,
+    value: UnsafeCell<Option<Number>>,
+}
+
+// SAFETY: `value` is only written while the slot is exclusively owned, either
+// before its handle is published or after its count dropped to zero.
+unsafe impl Sync for Slot {}
+
+#[derive(Debug)]
+struct Table {
+    chunks: Box<[OnceLock<Box<[Slot]>>]>,
+    fresh: AtomicU32,
+    free: AtomicU64,
+}
+
+static TABLE: OnceLock<Table> = OnceLock::new();
+
+fn table() -> &'static Table {
+    TABLE.get_or_init(|| Table {
+        chunks: (0..CHUNK_COUNT).map(|_| OnceLock::new()).collect(),
+        fresh: AtomicU32::new(0),
+        free: AtomicU64::new(u64::from(NIL)),
+    })
+}
+
+#[allow(clippy::as_conversions)]
+#[allow(clippy::cast_possible_truncation)]
+#[inline]
+#[must_use]
+const fn untag(head: u64) -> u32 {
+    head as u32
+}
+
+#[inline]
+#[must_use]
+fn retag(head: u64, index: u32) -> u64 {
+    ((head >> 32).wrapping_add(1) << 32) | u64::from(index)
+}
+
+/// # Panics
+#[allow(clippy::expect_used)]
+#[inline]
+#[must_use]
+fn index(handle: u64) -> u32 {
+    handle
+        .checked_sub(1)
+        .and_then(|index| u32::try_from(index).ok())
+        .expect("number handle")
+}
+
+impl Table {
+    /// # Panics
+    #[allow(clippy::as_conversions)]
+    #[allow(clippy::expect_used)]
+    fn slot(&self, index: u32) -> &Slot {
+        let index = index as usize;
+        self.chunks
+            .get(index >> CHUNK_BITS)
+            .expect("number table exhausted")
+            .get_or_init(|| (0..CHUNK_SIZE).map(|_| Slot::default()).collect())
+            .get(index & (CHUNK_SIZE - 1))
+            .expect("number table chunk")
+    }
+
+    fn allocate(&self) -> u32 {
+        let mut head = self.free.load(Ordering::Acquire);
+        while untag(head) != NIL {
+            let next = self.slot(untag(head)).next.load(Ordering::Relaxed);
+            match self.free.compare_exchange_weak(
+                head,
+                retag(head, next),
+                Ordering::Acquire,
+                Ordering::Acquire,
+            ) {
+                Ok(_) => return untag(head),
+                Err(actual) => head = actual,
+            }
+        }
+        self.fresh.fetch_add(1, Ordering::Relaxed)
+    }
+
+    fn deallocate(&self, index: u32) {
+        let slot = self.slot(index);
+        let mut head = self.free.load(Ordering::Relaxed);
+        loop {
+            slot.next.store(untag(head), Ordering::Relaxed);
+            match self.free.compare_exchange_weak(
+                head,
+                retag(head, index),
+                Ordering::Release,
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => return,
+                Err(actual) => head = actual,
+            }
+        }
+    }
+}
+
+/// Store `value` and return a handle owning one reference to it.
+#[inline]
+#[must_use]
+pub fn insert(value: Number) -> u64 {
+    let table = table();
+    let index = table.allocate();
+    let slot = table.slot(index);
+    // SAFETY: the slot was just taken off the free list or freshly allocated
+    // so no other thread can observe it until the handle is returned
+    unsafe {
+        *slot.value.get() = Some(value);
+    };
+    slot.refs.store(1, Ordering::Release);
+    u64::from(index) + 1
+}
+
+/// Borrow the number behind `handle` for the duration of `visitor`.
+///
+/// # Panics
+#[allow(clippy::expect_used)]
+#[inline]
+pub fn with<T, Visitor: FnOnce(&Number) -> T>(handle: u64, visitor: Visitor) -> T {
+    let slot = table().slot(index(handle));
+    // SAFETY: the caller owns a reference so the value cannot be taken
+    visitor(
+        unsafe { &*slot.value.get() }
+            .as_ref()
+            .expect("number handle"),
+    )
+}
+
+/// Clone the number behind `handle`.
+#[inline]
+#[must_use]
+pub fn get(handle: u64) -> Number {
+    with(handle, Clone::clone)
+}
+
+/// Add a reference to `handle` and return it.
+#[inline]
+#[must_use]
+pub fn retain(handle: u64) -> u64 {
+    table()
+        .slot(index(handle))
+        .refs
+        .fetch_add(1, Ordering::Relaxed);
+    handle
+}
+
+/// Drop a reference to `handle`, recycling the slot on the last one.
+/// The empty handle `0` is ignored.
+#[inline]
+pub fn release(handle: u64) {
+    if handle == 0 {
+        return;
+    }
+    let table = table();
+    let position = index(handle);
+    let slot = table.slot(position);
+    if slot.refs.fetch_sub(1, Ordering::Release) != 1 {
+        return;
+    }
+    fence(Ordering::Acquire);
+    // SAFETY: this was the last reference so the slot is exclusively owned
+    let value = unsafe { (*slot.value.get()).take() };
+    table.deallocate(position);
+    drop(value);
+}
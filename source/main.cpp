@@ -5,19 +5,18 @@
 #include "version.hpp"                        // for CHIMERA_GIT_HEAD, CHIM...
 #include "virtual_machine/global_context.hpp" // for GlobalContext
 
-#include "number-rust.hpp" // for r_vm_end
-
 #include <gsl/narrow>   // for narrow
 #include <gsl/span>     // for span_iterator, span
 #include <gsl/span_ext> // for make_span
 
-#include <cstring>   // for size_t, strncmp, strlen
-#include <exception> // for exception
-#include <iostream>  // for operator<<, char_traits
-#include <iterator>  // for distance, literals, next
-#include <stdexcept> // for runtime_error
-#include <string>    // for basic_string, to_string
-#include <vector>    // for vector
+#include <cstring>     // for size_t, strncmp, strlen
+#include <exception>   // for exception
+#include <iostream>    // for operator<<, char_traits
+#include <iterator>    // for distance, literals, next, prev
+#include <stdexcept>   // for runtime_error
+#include <string>      // for basic_string, to_string
+#include <string_view> // for operator==
+#include <vector>      // for vector
 
 // NOLINTBEGIN(misc-use-anonymous-namespace)
 
@@ -50,7 +49,6 @@ namespace chimera::library {
   using Argv = gsl::span<const char>;
   // NOLINTNEXTLINE(readability-function-cognitive-complexity)
   static auto main(Span &&args) noexcept -> int {
-    auto finally = gsl::finally([] { r_vm_end(); });
     std::cerr.exceptions(std::ios_base::failbit | std::ios_base::badbit);
     std::cin.exceptions(std::ios_base::failbit | std::ios_base::badbit);
     std::cout.exceptions(std::ios_base::failbit | std::ios_base::badbit);
@@ -184,13 +182,18 @@ namespace chimera::library {
                 ++argChar;
                 if (argChar != argCStr.end()) {
                   options.extensions.emplace_back(&*argChar);
-                  break;
+                } else {
+                  ++arg;
+                  if (arg == args.end()) {
+                    throw std::runtime_error("missing extension argument");
+                  }
+                  options.extensions.emplace_back(*arg);
                 }
-                ++arg;
-                if (arg == args.end()) {
-                  throw std::runtime_error("missing extension argument");
+                // the rest of this argument was the extension
+                argChar = std::prev(argCStr.end());
+                if (options.extensions.back() == "replay_loops"sv) {
+                  options.replay_loops = true;
                 }
-                options.extensions.emplace_back(*arg);
                 break;
               default:
                 throw std::runtime_error(
@@ -0,0 +1,97 @@
+"""generate_utf8_id_table.py."""
+
+from collections.abc import Callable, Iterable
+from pathlib import Path
+from unicodedata import unidata_version
+
+from asyncio_cmd import chunks
+
+utf8_id_table = (
+    Path(__file__).parent.parent / "library" / "grammar" / "utf8_id_table.hpp"
+).resolve()
+
+BLOCK = 0x100
+WORD = 64
+# str.isidentifier follows the interpreter's database, pin it so the header
+# regenerates identically, 15.1 needs Python 3.13
+UNICODE_VERSION = "15.1.0"
+
+
+def xid_start(code: int) -> bool:
+    return chr(code).isidentifier()
+
+
+def xid_continue(code: int) -> bool:
+    return f"_{chr(code)}".isidentifier()
+
+
+def _words(predicate: Callable[[int], bool], first: int) -> Iterable[int]:
+    for word in range(first, first + BLOCK, WORD):
+        yield sum(1 << bit for bit in range(WORD) if predicate(word + bit))
+
+
+def _tables(
+    limit: int, start: Callable[[int], bool], cont: Callable[[int], bool]
+) -> tuple[list[int], list[int]]:
+    unique: dict[tuple[int, ...], int] = {}
+    blocks = []
+    for first in range(0, limit, BLOCK):
+        bits = (*_words(start, first), *_words(cont, first))
+        blocks.append(unique.setdefault(bits, len(unique)))
+    assert len(unique) <= 0x100
+    return blocks, [word for bits in unique for word in bits]
+
+
+def _rows(values: Iterable[str], per_row: int) -> str:
+    return "\n".join(
+        "      " + ", ".join(row) + "," for row in chunks(values, per_row)
+    )
+
+
+def _table(
+    limit: int, start: Callable[[int], bool], cont: Callable[[int], bool]
+) -> str:
+    blocks, words = _tables(limit, start, cont)
+    return f"""  //! bitmap block for each run of {BLOCK} code points
+  inline constexpr std::array<std::uint8_t, {len(blocks)}> blocks{{{{
+{_rows((str(block) for block in blocks), 16)}
+  }}}};
+  //! {BLOCK // WORD} words of XID_Start then {BLOCK // WORD} of XID_Continue per block
+  inline constexpr std::array<std::uint64_t, {len(words)}> bits{{{{
+{_rows((f"0x{word:016x}U" for word in words), 3)}
+  }}}};"""
+
+
+def generate(
+    start: Callable[[int], bool] = xid_start,
+    cont: Callable[[int], bool] = xid_continue,
+) -> str:
+    return f"""//! generated file see tools/generate_utf8_id_table.py
+//! from Unicode {UNICODE_VERSION}
+
+#pragma once
+
+#include <array>   // for array
+#include <cstdint> // for uint8_t, uint64_t
+
+namespace chimera::library::grammar::utf8_id {{
+  //! block size and words per class in each block of bits
+  inline constexpr std::uint32_t block = {BLOCK};
+  inline constexpr std::uint32_t words = {BLOCK // WORD};
+#ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+  inline constexpr std::uint32_t limit = 0x100;
+{_table(0x100, start, cont)}
+#else
+  inline constexpr std::uint32_t limit = 0x110000;
+{_table(0x110000, start, cont)}
+#endif
+}} // namespace chimera::library::grammar::utf8_id
+"""
+
+
+if __name__ == "__main__":
+    if unidata_version != UNICODE_VERSION:
+        raise SystemExit(
+            f"Unicode {unidata_version} found, {UNICODE_VERSION} is required"
+        )
+    utf8_id_table.write_text(generate())
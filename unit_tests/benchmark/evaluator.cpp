@@ -0,0 +1,120 @@
+//! runs representative scripts through the evaluator, prints one JSON object
+//! per line with the time per statement, then the steps each script
+//! dispatched and how its specialised steps fared, so runs can be diffed
+
+#include "object/object.hpp"
+#include "options.hpp"
+#include "virtual_machine/global_context.hpp"
+#include "virtual_machine/step_profile.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+namespace chimera::library {
+  //! the evaluator has no loops that terminate on a counter yet, so each
+  //! script repeats its statements instead
+  static auto repeat(std::string_view setup, std::string_view statement,
+                     std::size_t count) -> std::string {
+    std::string script(setup);
+    script.reserve(setup.size() + statement.size() * count);
+    for (std::size_t index = 0; index < count; ++index) {
+      script += statement;
+    }
+    return script;
+  }
+  //! a loop running count times over count statements, each iteration
+  //! shifts a chain of flags down by one since there are no comparisons yet
+  static auto loop(std::size_t count) -> std::string {
+    std::string script;
+    for (std::size_t index = 0; index < count; ++index) {
+      script += "v" + std::to_string(index) + " = True\n";
+    }
+    script += "v" + std::to_string(count) + " = False\nwhile v0:\n";
+    for (std::size_t index = 0; index < count; ++index) {
+      script += "    v" + std::to_string(index) + " = v" +
+                std::to_string(index + 1) + "\n";
+    }
+    return script;
+  }
+  //! false when the script raised, the steps up to that point still count
+  static auto execute(const std::string &script, bool replayLoops) -> bool {
+    const Options options{.chimera = "chimera",
+                          .replay_loops = replayLoops,
+                          .exec = options::Command{script.c_str()}};
+    try {
+      return virtual_machine::make_global(options)->execute_script_string() ==
+             0;
+    } catch (const object::BaseException &) {
+      return false;
+    }
+  }
+  //! best of several untimed runs, then one more run with steps counted
+  static void report(std::string_view name, const std::string &script,
+                     std::size_t statements, bool replayLoops = false) {
+    using Clock = std::chrono::steady_clock;
+    auto best = Clock::duration::max();
+    auto completed = true;
+    for (auto run = 0; run < 5; ++run) {
+      auto start = Clock::now();
+      completed = execute(script, replayLoops) && completed;
+      best = std::min(best, Clock::now() - start);
+    }
+    std::cout << R"({"benchmark":"evaluator/)" << name << R"(","statements":)"
+              << statements << R"(,"ns_per_statement":)"
+              << static_cast<double>(
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(best)
+                         .count()) /
+                     static_cast<double>(statements)
+              << R"(,"completed":)" << (completed ? "true" : "false") << "}\n";
+    virtual_machine::profile::reset();
+    virtual_machine::profile::enable(true);
+    std::ignore = execute(script, replayLoops);
+    virtual_machine::profile::enable(false);
+    std::cout << R"({"benchmark":"evaluator/)" << name << R"(/steps","steps":[)";
+    auto separator = "";
+    for (const auto &step : virtual_machine::profile::steps()) {
+      std::cout << separator << R"({"step":")" << step.name << R"(","count":)"
+                << step.count << R"(,"ns":)" << step.time.count() << '}';
+      separator = ",";
+    }
+    std::cout << "]}\n";
+    const auto quickening = virtual_machine::profile::quickening();
+    std::cout << R"({"benchmark":"evaluator/)" << name
+              << R"(/quickening","specialised":)" << quickening.specialised
+              << R"(,"hits":)" << quickening.hits << R"(,"misses":)"
+              << quickening.misses << "}\n";
+  }
+} // namespace chimera::library
+
+auto main() -> int {
+  static constexpr std::size_t count = 1'000;
+  chimera::library::report(
+      "arithmetic",
+      chimera::library::repeat("a = 1\nb = 2\n", "a = a + b * 3 - b\n", count),
+      count);
+  chimera::library::report(
+      "attributes",
+      chimera::library::repeat("a = 1\n", "b = a.__class__.__name__\n", count),
+      count);
+  chimera::library::report(
+      "imports",
+      chimera::library::repeat("", "import sys\nfrom sys import argv\n",
+                               count),
+      count * 2);
+  chimera::library::report(
+      "tuples",
+      chimera::library::repeat("a = 1\n", "b = (a, (a, None), ('', a))\n",
+                               count),
+      count);
+  static constexpr std::size_t flags = 64;
+  chimera::library::report("loops", chimera::library::loop(flags),
+                           flags * flags);
+  chimera::library::report("loops/replayed", chimera::library::loop(flags),
+                           flags * flags, true);
+  return 0;
+}
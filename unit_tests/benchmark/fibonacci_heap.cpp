@@ -0,0 +1,181 @@
+//! compares FibonacciHeap with std::priority_queue, prints one JSON object
+//! per line so runs can be diffed
+
+#include "virtual_machine/fibonacci_heap.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using chimera::library::virtual_machine::FibonacciHeap;
+
+namespace chimera::library {
+  static auto keys(std::size_t count) -> std::vector<std::uint64_t> {
+    std::vector<std::uint64_t> keys;
+    keys.reserve(count);
+    std::uint64_t seed = count;
+    for (std::size_t index = 0; index < count; ++index) {
+      seed = seed * 6364136223846793005U + 1442695040888963407U;
+      keys.push_back(seed >> 16U);
+    }
+    return keys;
+  }
+  //! best of several runs, the checksum keeps the work observable
+  template <typename Function>
+  static void report(std::string_view name, std::size_t count,
+                     Function &&function) {
+    using Clock = std::chrono::steady_clock;
+    auto best = Clock::duration::max();
+    std::uint64_t checksum = 0;
+    for (auto run = 0; run < 5; ++run) {
+      auto start = Clock::now();
+      checksum += function();
+      best = std::min(best, Clock::now() - start);
+    }
+    std::cout << R"({"benchmark":")" << name << R"(","count":)" << count
+              << R"(,"ns_per_op":)"
+              << static_cast<double>(
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(best)
+                         .count()) /
+                     static_cast<double>(count)
+              << R"(,"checksum":)" << checksum << "}\n";
+  }
+  static void push_pop(std::size_t count) {
+    const auto values = keys(count);
+    report("fibonacci_heap/push_pop", count, [&values] {
+      FibonacciHeap<std::uint64_t> heap;
+      for (auto value : values) {
+        heap.emplace(value);
+      }
+      std::uint64_t sum = 0;
+      while (!heap.empty()) {
+        sum += heap.top();
+        heap.pop();
+      }
+      return sum;
+    });
+    report("priority_queue/push_pop", count, [&values] {
+      std::priority_queue<std::uint64_t, std::vector<std::uint64_t>,
+                          std::greater<>>
+          queue;
+      for (auto value : values) {
+        queue.push(value);
+      }
+      std::uint64_t sum = 0;
+      while (!queue.empty()) {
+        sum += queue.top();
+        queue.pop();
+      }
+      return sum;
+    });
+  }
+  //! the garbage collector merges each batch of newly tracked objects into
+  //! its long lived heap
+  static void merge(std::size_t count) {
+    static constexpr std::size_t batch = 64;
+    const auto values = keys(count);
+    report("fibonacci_heap/merge", count, [&values] {
+      FibonacciHeap<std::uint64_t> heap;
+      for (std::size_t index = 0; index < values.size(); index += batch) {
+        FibonacciHeap<std::uint64_t> pending;
+        for (auto offset = index;
+             offset < std::min(values.size(), index + batch); ++offset) {
+          pending.emplace(values[offset]);
+        }
+        heap.merge(std::move(pending));
+      }
+      return heap.top();
+    });
+    report("priority_queue/merge", count, [&values] {
+      using Queue = std::priority_queue<std::uint64_t,
+                                        std::vector<std::uint64_t>,
+                                        std::greater<>>;
+      Queue queue;
+      for (std::size_t index = 0; index < values.size(); index += batch) {
+        Queue pending;
+        for (auto offset = index;
+             offset < std::min(values.size(), index + batch); ++offset) {
+          pending.push(values[offset]);
+        }
+        while (!pending.empty()) {
+          queue.push(pending.top());
+          pending.pop();
+        }
+      }
+      return queue.top();
+    });
+  }
+  //! lowers every key once after a few pops, priority_queue has no
+  //! decrease-key so it pushes a duplicate and skips stale entries
+  static void decrease(std::size_t count) {
+    const auto values = keys(count);
+    report("fibonacci_heap/decrease", count, [&values] {
+      FibonacciHeap<std::pair<std::uint64_t, std::size_t>> heap;
+      std::vector<decltype(heap)::Handle> handles;
+      handles.reserve(values.size());
+      for (std::size_t index = 0; index < values.size(); ++index) {
+        handles.push_back(heap.emplace(values[index], index));
+      }
+      std::vector<bool> popped(values.size());
+      for (auto pops = 0; pops < 2; ++pops) {
+        popped[heap.top().second] = true;
+        heap.pop();
+      }
+      for (std::size_t index = 0; index < values.size(); ++index) {
+        if (!popped[index]) {
+          heap.decrease(handles[index], {values[index] / 2, index});
+        }
+      }
+      std::uint64_t sum = 0;
+      while (!heap.empty()) {
+        sum += heap.top().first;
+        heap.pop();
+      }
+      return sum;
+    });
+    report("priority_queue/decrease", count, [&values] {
+      using Entry = std::pair<std::uint64_t, std::size_t>;
+      std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+      std::vector<std::uint64_t> current(values);
+      for (std::size_t index = 0; index < values.size(); ++index) {
+        queue.emplace(values[index], index);
+      }
+      for (auto pops = 0; pops < 2; ++pops) {
+        current[queue.top().second] = 0;
+        queue.pop();
+      }
+      for (std::size_t index = 0; index < values.size(); ++index) {
+        if (current[index] != 0) {
+          current[index] = values[index] / 2;
+          queue.emplace(current[index], index);
+        }
+      }
+      std::uint64_t sum = 0;
+      while (!queue.empty()) {
+        auto [key, index] = queue.top();
+        queue.pop();
+        if (current[index] == key) {
+          sum += key;
+          current[index] = 0;
+        }
+      }
+      return sum;
+    });
+  }
+} // namespace chimera::library
+
+auto main() -> int {
+  for (std::size_t count : {1'000U, 100'000U}) {
+    chimera::library::push_pop(count);
+    chimera::library::merge(count);
+    chimera::library::decrease(count);
+  }
+  return 0;
+}
@@ -0,0 +1,181 @@
+//! parser throughput over the fuzz corpus and real python sources, prints one
+//! JSON object per grammar so runs can be diffed between commits
+
+#include "asdl/asdl.hpp"
+#include "grammar/rules.hpp"
+#include "options.hpp"
+
+#include <tao/pegtl.hpp>
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//! every allocation in the process, read before and after each grammar
+static std::atomic<std::uint64_t> allocations{0};
+
+auto operator new(std::size_t size) -> void * {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  if (auto *memory = std::malloc(size == 0 ? 1 : size); memory != nullptr) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+auto operator new(std::size_t size, std::align_val_t alignment) -> void * {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  auto align = static_cast<std::size_t>(alignment);
+  auto rounded = (std::max(size, std::size_t{1}) + align - 1) / align * align;
+  if (auto *memory = std::aligned_alloc(align, rounded); memory != nullptr) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void *memory) noexcept {
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  std::free(memory);
+}
+void operator delete(void *memory, std::size_t /*size*/) noexcept {
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  std::free(memory);
+}
+void operator delete(void *memory, std::align_val_t /*alignment*/) noexcept {
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  std::free(memory);
+}
+void operator delete(void *memory, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  std::free(memory);
+}
+
+namespace chimera::library {
+  struct Source {
+    std::string name;
+    std::string data;
+  };
+  static void load(const std::filesystem::path &path,
+                   std::vector<Source> &sources) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    sources.push_back({.name = path.string(),
+                       .data = {std::istreambuf_iterator<char>(file),
+                                std::istreambuf_iterator<char>()}});
+  }
+  //! fuzz shards have no extension, python sources end in .py, anything
+  //! else found in a directory is skipped
+  static auto sources(std::span<const char *const> paths)
+      -> std::vector<Source> {
+    std::vector<Source> sources;
+    for (const auto *each : paths) {
+      const std::filesystem::path path(each);
+      if (!std::filesystem::is_directory(path)) {
+        load(path, sources);
+        continue;
+      }
+      std::vector<std::filesystem::path> files;
+      for (const auto &entry :
+           std::filesystem::recursive_directory_iterator(path)) {
+        if (entry.is_regular_file() &&
+            (!entry.path().has_extension() ||
+             entry.path().extension() == ".py")) {
+          files.push_back(entry.path());
+        }
+      }
+      // directory order is unspecified, keep runs comparable
+      std::ranges::sort(files);
+      for (const auto &file : files) {
+        load(file, sources);
+      }
+    }
+    return sources;
+  }
+  //! process high water mark, it only grows so each grammar reports the
+  //! peak of everything parsed up to and including it
+  static auto peak_rss_kb() -> long {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+  }
+  //! best of several passes over every source, the first pass also counts
+  //! allocations and rejected sources
+  template <typename ASDL>
+  static void report(std::string_view name,
+                     const std::vector<Source> &sources) {
+    using Clock = std::chrono::steady_clock;
+    std::size_t bytes = 0;
+    for (const auto &source : sources) {
+      bytes += source.data.size();
+    }
+    auto best = Clock::duration::max();
+    std::uint64_t allocated = 0;
+    std::size_t failures = 0;
+    for (auto run = 0; run < 3; ++run) {
+      std::size_t failed = 0;
+      auto before = allocations.load(std::memory_order_relaxed);
+      auto start = Clock::now();
+      for (const auto &source : sources) {
+        std::istringstream input(source.data);
+        try {
+          ASDL parsed(options::Optimize::NONE, input, source.name.c_str());
+        } catch (const tao::pegtl::parse_error &) {
+          ++failed;
+        } catch (const grammar::SyntaxError &) {
+          ++failed;
+        }
+      }
+      best = std::min(best, Clock::now() - start);
+      if (run == 0) {
+        allocated = allocations.load(std::memory_order_relaxed) - before;
+        failures = failed;
+      }
+    }
+    auto seconds = std::chrono::duration<double>(best).count();
+    std::cout << R"({"benchmark":"parse/)" << name << R"(","files":)"
+              << sources.size() << R"(,"failures":)" << failures
+              << R"(,"bytes":)" << bytes << R"(,"bytes_per_second":)"
+              << static_cast<double>(bytes) / seconds
+              << R"(,"allocations_per_kb":)"
+              << static_cast<double>(allocated) * 1024.0 /
+                     static_cast<double>(std::max(bytes, std::size_t{1}))
+              << R"(,"peak_rss_kb":)" << peak_rss_kb() << "}\n";
+  }
+} // namespace chimera::library
+
+//! arguments are files or directories to parse, by default the fuzz corpus
+//! and the python parts of stdlib relative to the source tree
+auto main(int argc, char **argv) -> int {
+  static constexpr std::array<const char *, 2> defaults{
+      "unit_tests/fuzz/corpus", "stdlib"};
+  const auto arguments =
+      std::span<const char *const>(argv, static_cast<std::size_t>(argc))
+          .subspan(1);
+  const auto sources = chimera::library::sources(
+      arguments.empty() ? std::span<const char *const>(defaults) : arguments);
+  if (sources.empty()) {
+    std::cerr << "bench-parse: nothing to parse\n";
+    return 1;
+  }
+  chimera::library::report<chimera::library::asdl::Expression>("eval_input",
+                                                                 sources);
+  chimera::library::report<chimera::library::asdl::Interactive>("single_input",
+                                                                 sources);
+  chimera::library::report<chimera::library::asdl::Module>("file_input",
+                                                            sources);
+  return 0;
+}
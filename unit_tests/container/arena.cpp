@@ -0,0 +1,53 @@
+#include "container/arena.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using chimera::library::container::Arena;
+
+TEST_CASE("container Arena") {
+  std::vector<int> destroyed;
+  struct Tracked {
+    Tracked(std::vector<int> *destroyed, int index)
+        : destroyed(destroyed), index(index) {}
+    Tracked(const Tracked &other) = delete;
+    Tracked(Tracked &&other) = delete;
+    ~Tracked() noexcept { destroyed->push_back(index); }
+    auto operator=(const Tracked &other) -> Tracked & = delete;
+    auto operator=(Tracked &&other) -> Tracked & = delete;
+    std::vector<int> *destroyed;
+    int index;
+  };
+  {
+    Arena arena;
+    REQUIRE(Arena::current() == nullptr);
+    {
+      const Arena::Use use(arena);
+      REQUIRE(Arena::current() == &arena);
+      {
+        Arena inner;
+        const Arena::Use nested(inner);
+        REQUIRE(Arena::current() == &inner);
+      }
+      REQUIRE(Arena::current() == &arena);
+    }
+    REQUIRE(Arena::current() == nullptr);
+    for (auto index = 0; index < 1000; ++index) {
+      auto *tracked = arena.make<Tracked>(&destroyed, index);
+      REQUIRE(tracked->index == index);
+      auto *number = arena.make<std::uint64_t>(index);
+      REQUIRE(reinterpret_cast<std::uintptr_t>(number) %
+                  alignof(std::uint64_t) ==
+              0);
+    }
+    auto *large = static_cast<char *>(arena.allocate(1U << 20U, 64));
+    REQUIRE(reinterpret_cast<std::uintptr_t>(large) % 64 == 0);
+    large[(1U << 20U) - 1] = 0;
+    REQUIRE(destroyed.empty());
+  }
+  REQUIRE(destroyed.size() == 1000);
+  REQUIRE(destroyed.front() == 999);
+  REQUIRE(destroyed.back() == 0);
+}
@@ -0,0 +1,39 @@
+#include "container/nursery.hpp"
+#include "object/object.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using chimera::library::container::nursery_reset;
+using chimera::library::container::NurseryAllocator;
+using chimera::library::object::Object;
+using chimera::library::object::String;
+
+TEST_CASE("container NurseryAllocator") {
+  NurseryAllocator<std::uint64_t> allocator;
+  nursery_reset();
+  auto *first = allocator.allocate(1);
+  allocator.deallocate(first, 1);
+  nursery_reset();
+  auto *again = allocator.allocate(1);
+  REQUIRE(again == first);
+  auto *held = allocator.allocate(1);
+  allocator.deallocate(again, 1);
+  nursery_reset();
+  auto *next = allocator.allocate(1);
+  REQUIRE(next != first);
+  allocator.deallocate(next, 1);
+  std::thread([held, &allocator] { allocator.deallocate(held, 1); }).join();
+  std::vector<Object> objects;
+  for (auto index = 0; index < 10000; ++index) {
+    objects.emplace_back(String(std::to_string(index)),
+                         Object::BasicAttributes{});
+  }
+  std::thread([&objects] { objects.clear(); }).join();
+  auto *large = allocator.allocate(4096);
+  allocator.deallocate(large, 4096);
+}
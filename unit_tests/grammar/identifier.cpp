@@ -50,3 +50,39 @@ TEST_CASE("grammar identifier `raise`") {
   REQUIRE_FALSE(tao::pegtl::parse<chimera::library::grammar::AtomName<0>>(
       Input(input, "<unit>")));
 }
+
+TEST_CASE("grammar identifier long ASCII run with unicode tail") {
+  std::istringstream input(
+      "an_identifier_longer_than_one_vector_register_0123456789_caf\xc3\xa9_x"s);
+  REQUIRE(tao::pegtl::parse<tao::pegtl::seq<
+              chimera::library::grammar::Name<0>, tao::pegtl::eof>>(
+      Input(input, "<unit>")));
+}
+
+TEST_CASE("grammar identifier skips ASCII space and comments") {
+  std::istringstream input(
+      "name                                   \t # comment \xe2\x80\x94 more\n"s);
+  REQUIRE(tao::pegtl::parse<tao::pegtl::seq<
+              chimera::library::grammar::Name<0>, chimera::library::grammar::Eol,
+              tao::pegtl::eof>>(Input(input, "<unit>")));
+}
+
+TEST_CASE("grammar identifier `x1`") {
+  std::istringstream input("x1"s);
+  REQUIRE(tao::pegtl::parse<
+          tao::pegtl::seq<chimera::library::grammar::Name<0>, tao::pegtl::eof>>(
+      Input(input, "<unit>")));
+}
+
+TEST_CASE("grammar identifier table lookup") {
+  using chimera::library::grammar::utf8_id::lookup;
+  using chimera::library::grammar::utf8_id::Property;
+  REQUIRE(lookup(U'_', Property::XID_START));
+  REQUIRE_FALSE(lookup(U'7', Property::XID_START));
+  REQUIRE(lookup(U'7', Property::XID_CONTINUE));
+  REQUIRE(lookup(U'\u00e9', Property::XID_START));
+  REQUIRE(lookup(U'\u0301', Property::XID_CONTINUE));
+  REQUIRE_FALSE(lookup(U'\u0301', Property::XID_START));
+  REQUIRE_FALSE(lookup(U' ', Property::XID_CONTINUE));
+  REQUIRE_FALSE(lookup(0x110000, Property::XID_CONTINUE));
+}
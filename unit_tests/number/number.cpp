@@ -2,7 +2,12 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
 #include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 using chimera::library::object::number::Number;
 using NumericLimits = std::numeric_limits<std::uint64_t>;
@@ -197,3 +202,147 @@ TEST_CASE("number Number rational costly") {
   const auto extra = massive * three;
   REQUIRE(third == (massive / extra));
 }
+
+TEST_CASE("number Number small integer overflow") {
+  const Number one(1);
+  const Number small(NumericLimits::max() >> 2U);
+  auto number = small + one;
+  REQUIRE(number > small);
+  REQUIRE((number - one) == small);
+  number = small * Number(4);
+  REQUIRE((number / Number(4)) == small);
+  number = Number(0) - small - one - one;
+  REQUIRE(number < (Number(0) - small));
+  REQUIRE((number + one + one + small) == Number(0));
+  REQUIRE(Number(3).pow(Number(41)) ==
+          Number(3).pow(Number(40)) * Number(3));
+}
+
+TEST_CASE("number Number shifts") {
+  const Number huge(NumericLimits::max());
+  REQUIRE((Number(1) << Number(3)) == Number(8));
+  REQUIRE((Number(40) >> Number(3)) == Number(5));
+  REQUIRE((Number(40) >> Number(70)) == Number(0));
+  REQUIRE((Number(1) << Number(64)) == huge + Number(1));
+  REQUIRE(((huge + Number(1)) >> Number(60)) == Number(16));
+  REQUIRE(((huge << Number(8)) >> Number(8)) == huge);
+  REQUIRE((huge >> Number(64)) == Number(0));
+  REQUIRE(((Number(0) - Number(7)) << Number(2)) == Number(0) - Number(28));
+  REQUIRE(((Number(0) - Number(7)) >> Number(1)) == Number(0) - Number(4));
+  REQUIRE(((Number(0) - Number(7)) >> Number(70)) == Number(0) - Number(1));
+}
+
+TEST_CASE("number Number small integer signs") {
+  const auto negative = [](std::uint64_t value) {
+    return Number(0) - Number(value);
+  };
+  REQUIRE((negative(7) % Number(3)) == Number(2));
+  REQUIRE((Number(7) % negative(3)) == negative(2));
+  REQUIRE((negative(7) % negative(3)) == negative(1));
+  REQUIRE(negative(7).floor_div(Number(2)) == negative(4));
+  REQUIRE(Number(7).floor_div(negative(2)) == negative(4));
+  REQUIRE(negative(7).floor_div(negative(2)) == Number(3));
+  REQUIRE((negative(7) & Number(3)) == Number(1));
+  REQUIRE((negative(7) & negative(2)) == negative(8));
+  REQUIRE((negative(7) | Number(3)) == negative(5));
+  REQUIRE((negative(7) ^ Number(3)) == negative(6));
+  REQUIRE(~Number(7) == negative(8));
+  REQUIRE(~negative(8) == Number(7));
+  const Number small(NumericLimits::max() >> 2U);
+  REQUIRE((~small).is_small());
+  REQUIRE(~small == negative(0) - small - Number(1));
+  REQUIRE(~(negative(0) - small - Number(1)) == small);
+  const Number huge(NumericLimits::max());
+  REQUIRE(~huge == negative(0) - huge - Number(1));
+}
+
+TEST_CASE("number Number small integer demotion") {
+  const Number huge(NumericLimits::max());
+  REQUIRE_FALSE(huge.is_small());
+  const auto zero = huge.pow(Number(2)) - huge.pow(Number(2));
+  REQUIRE(zero.is_small());
+  REQUIRE((zero + Number(1)).is_small());
+  REQUIRE((huge / huge).is_small());
+  const auto negative = (Number(0) - huge) + (huge - Number(5));
+  REQUIRE(negative.is_small());
+  REQUIRE(negative == Number(0) - Number(5));
+  REQUIRE_FALSE((Number(0) - huge).is_small());
+  REQUIRE_FALSE((Number(1) / Number(3)).is_small());
+  REQUIRE_FALSE(Number(5).imag().is_small());
+}
+
+TEST_CASE("number Number small integer imag") {
+  const auto imag = Number(5).imag();
+  REQUIRE(imag.is_complex());
+  REQUIRE(imag.imag() == Number(5));
+}
+
+TEST_CASE("number Number batch") {
+  const Number huge(NumericLimits::max());
+  const Number small(NumericLimits::max() >> 2U);
+  const std::vector<Number> left{Number(1), huge, small, Number(7)};
+  const std::vector<Number> right{Number(2), huge, small, huge};
+  std::vector<Number> out(left.size());
+  Number::add(left, right, out);
+  for (std::size_t idx = 0; idx < out.size(); ++idx) {
+    REQUIRE(out[idx] == left[idx] + right[idx]);
+  }
+  Number::sub(left, right, out);
+  for (std::size_t idx = 0; idx < out.size(); ++idx) {
+    REQUIRE(out[idx] == left[idx] - right[idx]);
+  }
+  Number::mul(left, right, out);
+  for (std::size_t idx = 0; idx < out.size(); ++idx) {
+    REQUIRE(out[idx] == left[idx] * right[idx]);
+  }
+  std::array<bool, 4> flags{};
+  Number::eq(left, out, flags);
+  REQUIRE(flags == std::array<bool, 4>{false, false, false, false});
+  Number::eq(left, left, flags);
+  REQUIRE(flags == std::array<bool, 4>{true, true, true, true});
+  Number::lt(left, right, flags);
+  REQUIRE(flags == std::array<bool, 4>{true, false, false, true});
+  REQUIRE(Number::sum(left) == Number(1) + huge + small + Number(7));
+  REQUIRE(Number::sum(std::vector<Number>(4, small)) == small * Number(4));
+  REQUIRE(Number::sum({}) == Number(0));
+}
+
+TEST_CASE("number Number repr") {
+  const auto repr = [](const Number &number) {
+    std::ostringstream stream;
+    number.repr(static_cast<std::ostream &>(stream));
+    return stream.str();
+  };
+  const Number huge(NumericLimits::max());
+  REQUIRE(repr(Number(0)) == "0");
+  REQUIRE(repr(Number(0) - Number(42)) == "-42");
+  REQUIRE(repr(huge) == "18446744073709551615");
+  REQUIRE(repr(huge.pow(Number(5))) ==
+          "21359870359209100818160612599829711375476206146670800383156467550"
+          "56884185109834672074087649509375");
+}
+
+TEST_CASE("number Number threads") {
+  const Number huge(NumericLimits::max());
+  std::vector<std::uint64_t> results(8);
+  std::vector<std::thread> threads;
+  threads.reserve(results.size());
+  for (std::uint64_t idx = 0; idx < results.size(); ++idx) {
+    threads.emplace_back([&huge, &results, idx] {
+      Number number(idx);
+      for (std::uint64_t count = 0; count < 1000; ++count) {
+        const auto copy = number;
+        number = copy + huge;
+        number = number - huge;
+        number += Number(1);
+      }
+      results[idx] = std::uint64_t(number);
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (std::uint64_t idx = 0; idx < results.size(); ++idx) {
+    REQUIRE(results[idx] == idx + 1000);
+  }
+}
@@ -0,0 +1,186 @@
+#include "container/atomic_map.hpp"
+#include "container/flat_map.hpp"
+#include "container/snapshot_container.hpp"
+#include "object/object.hpp"
+#include "object/symbol.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using chimera::library::container::AtomicMap;
+using chimera::library::container::FlatMap;
+using chimera::library::container::SnapshotContainer;
+using chimera::library::object::AttributeError;
+using chimera::library::object::None;
+using chimera::library::object::Object;
+using chimera::library::object::String;
+using chimera::library::object::Symbol;
+
+using namespace std::literals;
+
+TEST_CASE("object Symbol") {
+  const Symbol symbol("__add__");
+  REQUIRE(symbol == Symbol(std::string("__add__")));
+  REQUIRE(symbol.name() == "__add__");
+  REQUIRE_FALSE(symbol == Symbol("__sub__"));
+}
+
+TEST_CASE("container FlatMap") {
+  FlatMap<std::uint64_t, std::uint64_t> map;
+  std::map<std::uint64_t, std::uint64_t> reference;
+  for (std::uint64_t key = 0; key < 1000; ++key) {
+    map.insert_or_assign(key * 7, key);
+    reference.insert_or_assign(key * 7, key);
+  }
+  for (std::uint64_t key = 0; key < 1000; key += 3) {
+    REQUIRE(map.erase(key * 7) == 1);
+    reference.erase(key * 7);
+  }
+  REQUIRE(map.erase(1) == 0);
+  REQUIRE(map.size() == reference.size());
+  for (const auto &[key, value] : reference) {
+    REQUIRE(map.at(key) == value);
+  }
+  for (const auto &[key, value] : map) {
+    REQUIRE(reference.at(key) == value);
+  }
+  REQUIRE_FALSE(map.contains(3 * 7));
+  map[3 * 7] = 3;
+  REQUIRE(map.at(3 * 7) == 3);
+}
+
+TEST_CASE("container AtomicMap") {
+  AtomicMap<std::string, std::string> map;
+  REQUIRE(map.try_emplace("key", "first") == std::pair{"first"s, true});
+  REQUIRE(map.try_emplace("key", "second") == std::pair{"first"s, false});
+  REQUIRE(map.find("key") == "first");
+  REQUIRE_FALSE(map.find("missing").has_value());
+  auto value = map.at("key");
+  map.erase("key");
+  REQUIRE(value == "first");
+  REQUIRE_THROWS_AS(map.at("key"), std::out_of_range);
+}
+
+TEST_CASE("object Object attributes") {
+  Object object(None{}, {});
+  object.set_attribute("b", Object());
+  object.set_attribute(Symbol("a"), Object());
+  REQUIRE(object.has_attribute("a"));
+  REQUIRE(object.has_attribute(Symbol("b")));
+  REQUIRE(object.dir() == std::vector<std::string>{"a", "b"});
+  object.delete_attribute("a");
+  REQUIRE_FALSE(object.has_attribute("a"));
+  REQUIRE_THROWS_AS(object.get_attribute("a"), AttributeError);
+}
+
+TEST_CASE("object Object attributes stored over") {
+  Object object(None{}, {{"a", Object(String("0"), {})}});
+  std::atomic<bool> done{false};
+  std::atomic<bool> consistent{true};
+  std::thread reader([&object, &done, &consistent] {
+    while (!done.load()) {
+      if (!object.get_attribute("a").get<String>()) {
+        consistent.store(false);
+      }
+    }
+  });
+  for (auto index = 0; index < 1000; ++index) {
+    object.set_attribute("a", Object(String(std::to_string(index)), {}));
+  }
+  done.store(true);
+  reader.join();
+  REQUIRE(consistent.load());
+  REQUIRE(object.get_attribute("a").get<String>() == "999");
+  REQUIRE(object.dir() == std::vector<std::string>{"a"});
+}
+
+TEST_CASE("object Shape") {
+  const auto &root = chimera::library::object::Shape::root();
+  const Symbol name("__name__");
+  const Symbol doc("__doc__");
+  REQUIRE(root->add(name) == root->add(name));
+  REQUIRE(root->add(name)->add(doc)->find(doc) == 1U);
+  REQUIRE(root->add(name)->add(doc)->remove(name) == root->add(doc));
+  REQUIRE_FALSE(root->add(doc)->find(name).has_value());
+}
+
+TEST_CASE("object Shape dictionary") {
+  auto shape = chimera::library::object::Shape::root();
+  for (auto index = 0; index < 100; ++index) {
+    shape = shape->add(Symbol("name" + std::to_string(index)));
+  }
+  const auto *dictionary = shape.get();
+  const Symbol extra("extra");
+  REQUIRE(shape->add(extra).get() == dictionary);
+  REQUIRE(shape->find(extra) == 100U);
+  REQUIRE(shape->keys().size() == 101);
+  auto removed = shape->remove(Symbol("name0"));
+  REQUIRE(removed.get() != dictionary);
+  REQUIRE(removed->find(extra) == 99U);
+  REQUIRE(shape->find(extra) == 100U);
+  Object object(None{}, {});
+  for (auto index = 0; index < 1000; ++index) {
+    object.set_attribute("name" + std::to_string(index),
+                         Object(String(std::to_string(index)), {}));
+  }
+  object.delete_attribute("name0");
+  REQUIRE(object.dir().size() == 999);
+  REQUIRE_FALSE(object.has_attribute("name0"));
+  REQUIRE(object.get_attribute("name999").get<String>() == "999");
+}
+
+TEST_CASE("object InlineCache") {
+  Object first(None{}, {{"a", Object(String("a"), {})},
+                        {"b", Object(String("first"), {})}});
+  const Object second(None{}, {{"a", Object(String("a"), {})},
+                               {"b", Object(String("second"), {})}});
+  chimera::library::object::InlineCache cacheB;
+  REQUIRE(first.find_attribute("b", cacheB)->get<String>() == "first");
+  REQUIRE(second.find_attribute("b", cacheB)->get<String>() == "second");
+  chimera::library::object::InlineCache cacheC;
+  REQUIRE_FALSE(first.find_attribute("c", cacheC).has_value());
+  first.set_attribute("c", Object(String("c"), {}), cacheC);
+  REQUIRE(first.find_attribute("c", cacheC)->get<String>() == "c");
+  first.set_attribute("c", Object(String("replaced"), {}), cacheC);
+  REQUIRE(first.find_attribute("c", cacheC)->get<String>() == "replaced");
+  REQUIRE(first.find_attribute("b", cacheB)->get<String>() == "first");
+}
+
+TEST_CASE("container SnapshotContainer") {
+  SnapshotContainer<std::vector<std::uint64_t>> container;
+  std::atomic<bool> done{false};
+  std::atomic<bool> consistent{true};
+  std::thread reader([&container, &done, &consistent] {
+    while (!done.load()) {
+      auto read = container.read();
+      for (std::uint64_t index = 0; index < read.value.size(); ++index) {
+        if (read.value[index] != index) {
+          consistent.store(false);
+        }
+      }
+    }
+  });
+  for (std::uint64_t index = 0; index < 1000; ++index) {
+    container.write().value.push_back(index);
+  }
+  done.store(true);
+  reader.join();
+  REQUIRE(consistent.load());
+  REQUIRE(container.read().value.size() == 1000);
+  REQUIRE_THROWS_AS(
+      [&container] {
+        auto write = container.write();
+        write.value.clear();
+        throw std::runtime_error("abandoned");
+      }(),
+      std::runtime_error);
+  REQUIRE(container.read().value.size() == 1000);
+}
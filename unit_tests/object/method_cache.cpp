@@ -0,0 +1,45 @@
+#include "object/method_cache.hpp"
+#include "object/object.hpp"
+#include "object/symbol.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using chimera::library::object::lookup_method;
+using chimera::library::object::None;
+using chimera::library::object::Object;
+using chimera::library::object::String;
+using chimera::library::object::Symbol;
+using chimera::library::object::Tuple;
+
+TEST_CASE("object method cache") {
+  Object base(None{}, {{"__add__", Object(String("base"), {})}});
+  Object type(None{}, {});
+  type.set_attribute("__mro__", Object(Tuple{type, base}, {}));
+  // the cache is per thread, its entries go with the thread
+  std::vector<std::string> found;
+  std::thread([&base, &type, &found] {
+    const Symbol add("__add__");
+    auto lookup = [&type, &add, &found] {
+      auto method = lookup_method(type, add);
+      found.push_back(method ? *method->get<String>() : "");
+    };
+    lookup();
+    lookup();
+    base.set_attribute("__add__", Object(String("replaced"), {}));
+    lookup();
+    type.set_attribute("__add__", Object(String("type"), {}));
+    lookup();
+    type.delete_attribute("__add__");
+    base.delete_attribute("__add__");
+    lookup();
+    base.set_attribute("__add__", Object(String("again"), {}));
+    lookup();
+  }).join();
+  REQUIRE(found == std::vector<std::string>{"base", "base", "replaced", "type",
+                                            "", "again"});
+  type.delete_attribute("__mro__");
+}
@@ -0,0 +1,39 @@
+#include "object/object.hpp"
+#include "object/reference.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using chimera::library::object::Object;
+using chimera::library::object::String;
+
+TEST_CASE("object Reference biased counts") {
+  auto object = Object(String("owned"), {});
+  auto weak = object.weak();
+  REQUIRE(object.use_count() == 1);
+  {
+    std::vector<Object> copies(4, object);
+    REQUIRE(object.use_count() == 5);
+    std::thread([copies = std::move(copies)]() mutable { copies.clear(); })
+        .join();
+  }
+  REQUIRE(object.use_count() == 1);
+  REQUIRE(Object(weak).get<String>() == "owned");
+  std::thread([moved = std::move(object)] {}).join();
+  chimera::library::object::process_released();
+  REQUIRE(weak.use_count() == 0);
+  REQUIRE_THROWS_AS(Object(weak), std::bad_weak_ptr);
+  Object orphan;
+  std::thread([&orphan] {
+    orphan = Object(String("orphan"), {});
+  }).join();
+  auto orphanWeak = orphan.weak();
+  auto copy = orphan;
+  REQUIRE(orphan.use_count() == 2);
+  orphan = copy = Object();
+  REQUIRE(orphanWeak.use_count() == 0);
+}
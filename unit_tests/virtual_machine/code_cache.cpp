@@ -0,0 +1,112 @@
+#include "asdl/asdl.hpp"
+#include "asdl/serialize.hpp"
+#include "options.hpp"
+#include "virtual_machine/code_cache.hpp"
+#include "virtual_machine/global_context.hpp"
+#include "virtual_machine/process_context.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace std::literals;
+
+namespace chimera::library {
+  static auto parse(std::string_view data) -> asdl::Module {
+    const Options options{.chimera = "chimera",
+                          .exec = options::Script{"unit_test.py"}};
+    auto globalContext = virtual_machine::make_global(options);
+    const auto processContext = virtual_machine::make_process(globalContext);
+    std::istringstream istream{std::string{data}};
+    return processContext->parse_file(
+        istream, "<unit_tests/virtual_machine/code_cache.cpp>");
+  }
+  static void write(const std::filesystem::path &path, std::string_view data) {
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    output << data;
+  }
+} // namespace chimera::library
+
+static constexpr auto source =
+    "'''doc'''\n"
+    "import sys as system\n"
+    "from os import path\n"
+    "def f(a, *b, c=1, **d) -> int:\n"
+    "    '''f'''\n"
+    "    return [x ** 2 for x in b if x] or {a: -c}\n"
+    "class C(object, metaclass=type):\n"
+    "    pass\n"
+    "try:\n"
+    "    f(1, 2, 3)[1:2, ...]\n"
+    "except ValueError as error:\n"
+    "    raise RuntimeError() from error\n"
+    "finally:\n"
+    "    del f\n"
+    "with open('x') as y:\n"
+    "    y += b'bytes' if 3j else 18446744073709551616 / 7\n"
+    "while not None:\n"
+    "    break\n"
+    "assert f, 'message'\n"sv;
+
+TEST_CASE("virtual machine serialize round trip") {
+  using chimera::library::asdl::deserialize;
+  using chimera::library::asdl::serialize;
+  const auto module = chimera::library::parse(source);
+  const auto data = serialize(module);
+  const auto copy = deserialize(data);
+  REQUIRE(copy.iter().size() == module.iter().size());
+  REQUIRE(copy.doc().has_value());
+  REQUIRE(serialize(copy) == data);
+  REQUIRE_THROWS(deserialize(std::string_view(data).substr(1)));
+}
+
+TEST_CASE("virtual machine CodeCache") {
+  using chimera::library::asdl::serialize;
+  using chimera::library::virtual_machine::CodeCache;
+  const auto directory =
+      std::filesystem::temp_directory_path() / "chimera-code-cache-test";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  const auto script = (directory / "script.py").string();
+  chimera::library::write(script, source);
+  const auto module = chimera::library::parse(source);
+  const auto optimize = chimera::library::options::Optimize::NONE;
+  {
+    const CodeCache cache(script, optimize);
+    REQUIRE_FALSE(cache.load().has_value());
+    cache.store(module);
+    REQUIRE(std::filesystem::exists(cache.path()));
+    auto loaded = cache.load();
+    REQUIRE(loaded.has_value());
+    REQUIRE(serialize(*loaded) == serialize(module));
+  }
+  REQUIRE_FALSE(
+      CodeCache(script, chimera::library::options::Optimize::BASIC)
+          .load()
+          .has_value());
+  chimera::library::write(script, "pass\n"sv);
+  REQUIRE_FALSE(CodeCache(script, optimize).load().has_value());
+  std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("virtual machine parse mapped file") {
+  using chimera::library::asdl::Module;
+  using chimera::library::asdl::serialize;
+  const auto directory =
+      std::filesystem::temp_directory_path() / "chimera-mapped-file-test";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  const auto script = (directory / "script.py").string();
+  chimera::library::write(script, source);
+  const auto optimize = chimera::library::options::Optimize::NONE;
+  const Module mapped(optimize, script.c_str());
+  REQUIRE(serialize(mapped) == serialize(chimera::library::parse(source)));
+  const auto empty = (directory / "empty.py").string();
+  chimera::library::write(empty, ""sv);
+  REQUIRE(Module(optimize, empty.c_str()).iter().empty());
+  std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,158 @@
+#include "object/object.hpp"
+#include "virtual_machine/fibonacci_heap.hpp"
+#include "virtual_machine/garbage.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using chimera::library::object::Object;
+using chimera::library::virtual_machine::FibonacciHeap;
+using chimera::library::virtual_machine::GarbageCollector;
+
+namespace chimera::library {
+  static auto make_object() -> Object {
+    return Object(std::map<std::string, Object>{});
+  }
+  //! the collector thread may hold the last reference for a moment
+  template <typename Weak>
+  static auto released(GarbageCollector &collector, const Weak &weak) -> bool {
+    for (auto attempt = 0; attempt < 8; ++attempt) {
+      collector.collect();
+      if (weak.use_count() == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+} // namespace chimera::library
+
+TEST_CASE("virtual machine FibonacciHeap") {
+  FibonacciHeap<int> heap;
+  REQUIRE(heap.empty());
+  for (auto value : {5, 3, 8, 1, 9}) {
+    heap.emplace(value);
+  }
+  REQUIRE(heap.top() == 1);
+  FibonacciHeap<int> other;
+  other.emplace(0);
+  other.emplace(7);
+  heap.merge(std::move(other));
+  REQUIRE(other.empty());
+  REQUIRE(heap.size() == 7);
+  REQUIRE(heap.top() == 0);
+  REQUIRE(heap.remove_if([](auto value) { return value % 2 == 0; }) == 2);
+  REQUIRE(heap.size() == 5);
+  REQUIRE(heap.top() == 1);
+  std::vector<int> values;
+  heap.for_each([&values](auto value) { values.push_back(value); });
+  REQUIRE(values.size() == 5);
+  heap.clear();
+  REQUIRE(heap.empty());
+}
+
+TEST_CASE("virtual machine FibonacciHeap order") {
+  FibonacciHeap<std::uint64_t> heap;
+  std::multiset<std::uint64_t> reference;
+  std::vector<FibonacciHeap<std::uint64_t>::Handle> handles;
+  std::uint64_t seed = 1;
+  auto random = [&seed] {
+    seed = seed * 6364136223846793005U + 1442695040888963407U;
+    return seed >> 33U;
+  };
+  for (auto round = 0; round < 2000; ++round) {
+    auto value = random() % 100000 + 1000;
+    handles.push_back(heap.emplace(value));
+    reference.insert(value);
+    if (round % 3 == 0) {
+      REQUIRE(heap.top() == *reference.begin());
+      reference.erase(reference.begin());
+      heap.pop();
+      handles.clear();
+    }
+  }
+  for (auto handle : handles) {
+    reference.erase(reference.find(*handle));
+    auto lower = *handle % 1000;
+    heap.decrease(handle, lower);
+    reference.insert(lower);
+  }
+  REQUIRE(heap.size() == reference.size());
+  while (!heap.empty()) {
+    REQUIRE(heap.top() == *reference.begin());
+    reference.erase(reference.begin());
+    heap.pop();
+  }
+  REQUIRE(reference.empty());
+}
+
+TEST_CASE("virtual machine FibonacciHeap erase") {
+  FibonacciHeap<int> heap;
+  std::vector<FibonacciHeap<int>::Handle> handles;
+  for (auto value = 0; value < 100; ++value) {
+    handles.push_back(heap.emplace(value));
+  }
+  heap.pop();
+  heap.erase(handles[50]);
+  heap.erase(handles[1]);
+  REQUIRE(heap.size() == 97);
+  REQUIRE(heap.top() == 2);
+  REQUIRE(heap.remove_if([](auto value) { return value < 60; }) == 57);
+  auto expected = 60;
+  while (!heap.empty()) {
+    REQUIRE(heap.top() == expected++);
+    heap.pop();
+  }
+}
+
+TEST_CASE("virtual machine GarbageCollector cycle") {
+  GarbageCollector collector([] { return std::vector<Object>{}; });
+  auto weak = [&collector] {
+    auto first = chimera::library::make_object();
+    auto second = chimera::library::make_object();
+    first.set_attribute("other", second);
+    second.set_attribute("other", first);
+    collector.track(first);
+    collector.track(second);
+    return first.weak();
+  }();
+  REQUIRE(chimera::library::released(collector, weak));
+}
+
+TEST_CASE("virtual machine GarbageCollector acyclic") {
+  GarbageCollector collector([] { return std::vector<Object>{}; });
+  auto weak = [&collector] {
+    auto object = chimera::library::make_object();
+    object.set_attribute("self", chimera::library::make_object());
+    collector.track(object);
+    return object.weak();
+  }();
+  REQUIRE(chimera::library::released(collector, weak));
+}
+
+TEST_CASE("virtual machine GarbageCollector keeps referenced cycles") {
+  auto root = chimera::library::make_object();
+  GarbageCollector collector(
+      [&root] { return std::vector<Object>{root}; });
+  auto held = chimera::library::make_object();
+  {
+    auto rooted = chimera::library::make_object();
+    rooted.set_attribute("self", rooted);
+    root.set_attribute("rooted", rooted);
+    collector.track(rooted);
+    held.set_attribute("self", held);
+    collector.track(held);
+  }
+  collector.collect();
+  collector.collect();
+  REQUIRE(root.get_attribute("rooted").has_attribute("self"));
+  REQUIRE(held.has_attribute("self"));
+  root.get_attribute("rooted").delete_attribute("self");
+  held.delete_attribute("self");
+  collector.collect();
+}
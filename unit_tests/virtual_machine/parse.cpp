@@ -1,3 +1,4 @@
+#include "asdl/asdl.hpp"
 #include "grammar/grammar.hpp"
 #include "grammar/rules.hpp"
 #include "grammar/rules/control.hpp"
@@ -78,3 +79,51 @@ TEST_CASE("virtual machine parse `if True:\\n  False\\nTrue\\nFalse`") {
 TEST_CASE("virtual machine parse `raise`") {
   REQUIRE_NOTHROW(chimera::library::test_parse("raise"sv, 1));
 }
+
+TEST_CASE("virtual machine parse resolves names") {
+  using chimera::library::asdl::Binding;
+  const chimera::library::Options options{
+      .chimera = "chimera", .exec = chimera::library::options::Script{
+                                "unit_test.py"}};
+  auto globalContext = chimera::library::virtual_machine::make_global(options);
+  const auto processContext =
+      chimera::library::virtual_machine::make_process(globalContext);
+  std::istringstream istream{"x = 1\n"
+                             "def f(a, b=x):\n"
+                             "    global g\n"
+                             "    c = a\n"
+                             "    def h():\n"
+                             "        c\n"
+                             "        g\n"
+                             "    return h\n"s};
+  auto module = processContext->parse_file(
+      istream, "<unit_tests/virtual_machine/parse.cpp>");
+  auto binding = [](const chimera::library::asdl::ExprImpl &expr) {
+    auto name = expr.get<chimera::library::asdl::Name>();
+    REQUIRE(name);
+    return name->binding;
+  };
+  REQUIRE(module.iter().size() == 2);
+  auto x = module.iter().front().get<chimera::library::asdl::Assign>();
+  REQUIRE(x);
+  REQUIRE(binding(x->targets.front()).kind == Binding::GLOBAL);
+  auto f = module.iter().back().get<chimera::library::asdl::FunctionDef>();
+  REQUIRE(f);
+  REQUIRE(f->locals == 4);
+  REQUIRE(binding(*f->args.args.back().arg_default).kind == Binding::GLOBAL);
+  auto c = f->body.at(1).get<chimera::library::asdl::Assign>();
+  REQUIRE(c);
+  REQUIRE(binding(c->targets.front()).kind == Binding::LOCAL);
+  REQUIRE(binding(c->targets.front()).slot == 2);
+  REQUIRE(binding(c->value).kind == Binding::LOCAL);
+  REQUIRE(binding(c->value).slot == 0);
+  auto h = f->body.at(2).get<chimera::library::asdl::FunctionDef>();
+  REQUIRE(h);
+  REQUIRE(h->locals == 0);
+  auto free = h->body.at(0).get<chimera::library::asdl::Expr>();
+  REQUIRE(free);
+  REQUIRE(binding(free->value).kind == Binding::FREE);
+  auto global = h->body.at(1).get<chimera::library::asdl::Expr>();
+  REQUIRE(global);
+  REQUIRE(binding(global->value).kind == Binding::GLOBAL);
+}
@@ -4,21 +4,48 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 using namespace std::literals;
 
 namespace chimera::library::virtual_machine {
-  void parse_file(std::string_view &&data) {
+  //! visit sees the main module before the process context tears it down
+  template <typename Visit>
+  void evaluate_main(std::string_view data, bool replayLoops, Visit &&visit) {
     const Options options{.chimera = "chimera",
+                          .replay_loops = replayLoops,
                           .exec = options::Script{"test.py"}};
     auto globalContext = make_global(options);
     auto processContext = make_process(globalContext);
     std::istringstream input{std::string{data}};
     auto module = processContext->parse_file(input, "<test>");
-    auto threadContext =
-        make_thread(processContext, processContext->make_module("__main__"));
+    auto main = processContext->make_module("__main__");
+    auto threadContext = make_thread(processContext, main);
     Evaluator(threadContext).evaluate(module);
+    std::forward<Visit>(visit)(main);
+  }
+  void parse_file(std::string_view &&data, bool replayLoops = false) {
+    evaluate_main(data, replayLoops, [](const object::Object & /*main*/) {});
+  }
+  //! the number data bound to name in the main module, if any
+  auto evaluate_number(std::string_view &&data, std::string_view name,
+                       bool replayLoops = false)
+      -> std::optional<object::Number> {
+    std::optional<object::Number> result;
+    evaluate_main(data, replayLoops,
+                  [&result, name](const object::Object &main) {
+                    auto value = main.get_attribute(name);
+                    if (auto number = value.get<object::Number>()) {
+                      result.emplace(*number);
+                    }
+                  });
+    return result;
   }
 } // namespace chimera::library::virtual_machine
 
@@ -30,8 +57,18 @@ TEST_CASE("grammar VirtualMachine ``") {
 }
 
 TEST_CASE("grammar VirtualMachine `type`") {
-  REQUIRE_THROWS_AS(chimera::library::virtual_machine::parse_file("type"sv),
-                    chimera::library::object::BaseException);
+  REQUIRE_NOTHROW(chimera::library::virtual_machine::parse_file("type"sv));
+}
+
+TEST_CASE("grammar VirtualMachine `undefined`") {
+  REQUIRE_THROWS_AS(
+      chimera::library::virtual_machine::parse_file("undefined"sv),
+      chimera::library::object::BaseException);
+}
+
+TEST_CASE("grammar VirtualMachine `a = None\\nb = a`") {
+  REQUIRE_NOTHROW(
+      chimera::library::virtual_machine::parse_file("a = None\nb = a"sv));
 }
 
 TEST_CASE("grammar VirtualMachine `a@b=c`") {
@@ -39,10 +76,85 @@ TEST_CASE("grammar VirtualMachine `a@b=c`") {
                     chimera::library::object::BaseException);
 }
 
-TEST_CASE("grammar VirtualMachine `0x10 & 0x01`") {
-  REQUIRE_THROWS_AS(
-      chimera::library::virtual_machine::parse_file("0x10 & 0x01"sv),
-      chimera::library::object::BaseException);
+TEST_CASE("grammar VirtualMachine `b = 0x10 & 0x01`") {
+  REQUIRE(chimera::library::virtual_machine::evaluate_number(
+              "b = 0x10 & 0x01"sv, "b") == chimera::library::object::Number());
+}
+
+TEST_CASE("grammar VirtualMachine `a = 7\\nb = a * 3 - a // 2 ** 2 % 5`") {
+  REQUIRE(chimera::library::virtual_machine::evaluate_number(
+              "a = 7\nb = a * 3 - a // 2 ** 2 % 5"sv, "b") ==
+          chimera::library::object::Number(20U));
+}
+
+TEST_CASE("grammar VirtualMachine binary operator values") {
+  using chimera::library::object::Number;
+  const auto negative = [](std::uint64_t value) {
+    return Number() - Number(value);
+  };
+  const std::vector<std::pair<std::string_view, Number>> cases{
+      {"b = 7 + 3"sv, Number(10U)},
+      {"b = 7 - 10"sv, negative(3U)},
+      {"b = 7 * 3"sv, Number(21U)},
+      {"b = 2 ** 10"sv, Number(1024U)},
+      {"b = 1 << 3"sv, Number(8U)},
+      {"b = 1 << 70"sv,
+       Number(std::uint64_t{1} << 35U) * Number(std::uint64_t{1} << 35U)},
+      {"b = 40 >> 3"sv, Number(5U)},
+      {"b = 40 >> 70"sv, Number()},
+      {"b = 0x10 | 0x01"sv, Number(17U)},
+      {"b = 0x11 ^ 0x01"sv, Number(16U)},
+      {"b = 0x11 & 0x01"sv, Number(1U)},
+      {"b = 7 % 3"sv, Number(1U)},
+      {"b = 7 // 2"sv, Number(3U)},
+      {"n = 0 - 7\nb = n % 3"sv, Number(2U)},
+      {"n = 0 - 3\nb = 7 % n"sv, negative(2U)},
+      {"n = 0 - 7\nb = n % (0 - 3)"sv, negative(1U)},
+      {"n = 0 - 7\nb = n // 2"sv, negative(4U)},
+      {"n = 0 - 2\nb = 7 // n"sv, negative(4U)},
+      {"n = 0 - 7\nb = n // (0 - 2)"sv, Number(3U)},
+      {"n = 0 - 7\nb = n & 3"sv, Number(1U)},
+      {"n = 0 - 7\nb = n & (0 - 2)"sv, negative(8U)},
+      {"n = 0 - 7\nb = n | 3"sv, negative(5U)},
+      {"n = 0 - 7\nb = n ^ 3"sv, negative(6U)},
+      {"n = 0 - 7\nb = n >> 1"sv, negative(4U)},
+      {"n = 0 - 7\nb = n >> 70"sv, negative(1U)},
+      {"n = 0 - 7\nb = n << 2"sv, negative(28U)},
+  };
+  for (const auto &[script, expected] : cases) {
+    REQUIRE(chimera::library::virtual_machine::evaluate_number(
+                std::string_view{script}, "b") == expected);
+  }
+}
+
+TEST_CASE("grammar VirtualMachine `a = 7\\nb = a * 3` value") {
+  REQUIRE(chimera::library::virtual_machine::evaluate_number(
+              "a = 7\nb = a * 3"sv, "b") ==
+          chimera::library::object::Number(21U));
+}
+
+TEST_CASE("grammar VirtualMachine quickened binary operator value") {
+  using chimera::library::object::Number;
+  static constexpr std::size_t count = 12;
+  std::string script = "a = 0\n";
+  for (std::size_t index = 0; index < count; ++index) {
+    script += "v" + std::to_string(index) + " = True\n";
+  }
+  script += "v" + std::to_string(count) + " = False\nwhile v0:\n";
+  script += "    a = a + 3\n";
+  for (std::size_t index = 0; index < count; ++index) {
+    script += "    v" + std::to_string(index) + " = v" +
+              std::to_string(index + 1) + "\n";
+  }
+  REQUIRE(chimera::library::virtual_machine::evaluate_number(
+              std::string_view{script}, "a") == Number(3U * count));
+  REQUIRE(chimera::library::virtual_machine::evaluate_number(
+              std::string_view{script}, "a", true) == Number(3U * count));
+}
+
+TEST_CASE("grammar VirtualMachine `1 // 0`") {
+  REQUIRE_THROWS_AS(chimera::library::virtual_machine::parse_file("1 // 0"sv),
+                    chimera::library::object::BaseException);
 }
 
 TEST_CASE("grammar VirtualMachine `()`") {
@@ -82,3 +194,74 @@ TEST_CASE("grammar VirtualMachine `[None,None][None,0]`") {
       chimera::library::virtual_machine::parse_file("[None,None][None,0]"sv),
       chimera::library::object::BaseException);
 }
+
+TEST_CASE("grammar VirtualMachine replayed loop") {
+  static constexpr auto loop = "a = True\n"
+                               "b = True\n"
+                               "c = True\n"
+                               "d = True\n"
+                               "e = True\n"
+                               "f = False\n"
+                               "while a:\n"
+                               "    a = b\n"
+                               "    b = c\n"
+                               "    c = d\n"
+                               "    d = e\n"
+                               "    e = f\n"sv;
+  REQUIRE_NOTHROW(
+      chimera::library::virtual_machine::parse_file(std::string_view{loop}));
+  REQUIRE_NOTHROW(chimera::library::virtual_machine::parse_file(
+      std::string_view{loop}, true));
+}
+
+TEST_CASE("virtual machine quickening") {
+  using chimera::library::asdl::Quickening;
+  Quickening quickening;
+  for (auto count = 1U; count < Quickening::threshold; ++count) {
+    REQUIRE_FALSE(quickening.observe(Quickening::INT));
+  }
+  REQUIRE(quickening.kind() == Quickening::GENERIC);
+  REQUIRE(quickening.observe(Quickening::INT));
+  REQUIRE(quickening.kind() == Quickening::INT);
+  quickening.deoptimize();
+  REQUIRE(quickening.kind() == Quickening::GENERIC);
+  SECTION("generic operands restart the streak") {
+    for (auto count = 1U; count < Quickening::threshold; ++count) {
+      REQUIRE_FALSE(quickening.observe(Quickening::INT));
+    }
+    REQUIRE_FALSE(quickening.observe(Quickening::GENERIC));
+    REQUIRE_FALSE(quickening.observe(Quickening::INT));
+    REQUIRE(quickening.kind() == Quickening::GENERIC);
+  }
+}
+
+TEST_CASE("virtual machine loop hotness") {
+  using chimera::library::asdl::Hotness;
+  Hotness hotness;
+  for (auto count = 1U; count < Hotness::threshold; ++count) {
+    REQUIRE_FALSE(hotness.run());
+  }
+  REQUIRE(hotness.run());
+  REQUIRE(hotness.run());
+  hotness.disable();
+  REQUIRE_FALSE(hotness.run());
+}
+
+TEST_CASE("grammar VirtualMachine replayed loop in a function") {
+  static constexpr auto loop = "def f():\n"
+                               "    a = True\n"
+                               "    b = True\n"
+                               "    c = True\n"
+                               "    d = True\n"
+                               "    e = False\n"
+                               "    while a:\n"
+                               "        a = b\n"
+                               "        b = c\n"
+                               "        c = d\n"
+                               "        d = e\n"
+                               "f()\n"
+                               "f()\n"
+                               "f()\n"sv;
+  REQUIRE_NOTHROW(chimera::library::virtual_machine::parse_file(
+      std::string_view{loop}, true));
+}